@@ -0,0 +1,97 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <baba-is-auto/Agents/MCTSAgent.hpp>
+#include <baba-is-auto/Games/Game.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace baba_is_auto;
+
+// Usage: MCTS [maps directory] [seconds per search]
+//
+// Runs one time-bounded search of MCTSAgent from the start of each map with
+// root and tree parallelism on 1, 2, 4, ... threads up to the number of
+// hardware threads, and prints the rollout throughput in total and per
+// thread.
+int main(int argc, char* argv[])
+{
+    const std::string mapsDir = argc > 1 ? argv[1] : MAPS_DIR;
+    const double seconds = argc > 2 ? std::strtod(argv[2], nullptr) : 1.0;
+
+    std::vector<std::filesystem::path> maps;
+    for (const auto& entry : std::filesystem::directory_iterator(mapsDir))
+    {
+        if (entry.path().extension() == ".txt")
+        {
+            maps.emplace_back(entry.path());
+        }
+    }
+    std::sort(maps.begin(), maps.end());
+
+    std::vector<std::size_t> threadCounts{ 1 };
+    const std::size_t maxThreads =
+        std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+    while (threadCounts.back() * 2 <= maxThreads)
+    {
+        threadCounts.emplace_back(threadCounts.back() * 2);
+    }
+    if (threadCounts.back() != maxThreads)
+    {
+        threadCounts.emplace_back(maxThreads);
+    }
+
+    std::printf("%-18s %-5s %7s %10s %10s %12s %12s %12s\n", "map", "mode",
+                "threads", "rollouts", "nodes", "rollouts/s",
+                "per thread", "steps/s");
+
+    for (const auto& path : maps)
+    {
+        const std::string name = path.filename().string();
+        const Game game(path.string());
+        if (game.GetPlayState() != PlayState::PLAYING)
+        {
+            continue;
+        }
+
+        for (const MCTSParallelism parallelism :
+             { MCTSParallelism::ROOT, MCTSParallelism::TREE })
+        {
+            for (const std::size_t numThreads : threadCounts)
+            {
+                MCTSOptions options;
+                options.maxIterations = 0;
+                options.maxSeconds = seconds;
+                options.numThreads = numThreads;
+                options.parallelism = parallelism;
+
+                MCTSAgent agent(options);
+                agent.Search(game);
+
+                const MCTSStats& stats = agent.GetStats();
+                std::printf(
+                    "%-18s %-5s %7zu %10zu %10zu %12.0f %12.0f %12.0f\n",
+                    name.c_str(),
+                    parallelism == MCTSParallelism::ROOT ? "root" : "tree",
+                    numThreads, stats.rollouts, stats.treeNodes,
+                    stats.GetRolloutsPerSecond(),
+                    stats.GetRolloutsPerSecondPerThread(),
+                    stats.elapsedSeconds > 0.0
+                        ? static_cast<double>(stats.rolloutSteps) /
+                              stats.elapsedSeconds
+                        : 0.0);
+            }
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,104 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <baba-is-auto/Agents/BFSSolverAgent.hpp>
+#include <baba-is-auto/Agents/ParallelBFSSolverAgent.hpp>
+#include <baba-is-auto/Games/Game.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace baba_is_auto;
+
+namespace
+{
+void PrintRow(const std::string& map, const std::string& agent,
+              std::size_t numThreads, const SolverAgent& solver,
+              double baseNodesPerSecond)
+{
+    const SearchStats& stats = solver.GetStats();
+    const double nodesPerSecond = stats.GetNodesPerSecond();
+
+    std::printf("%-18s %-8s %7zu %6d %6zu %10zu %8.2f %12.0f %7.2f\n",
+                map.c_str(), agent.c_str(), numThreads,
+                static_cast<int>(solver.GetStatus()),
+                solver.GetSolution().size(), stats.nodesExpanded,
+                stats.elapsedSeconds, nodesPerSecond,
+                baseNodesPerSecond > 0.0 ? nodesPerSecond / baseNodesPerSecond
+                                         : 0.0);
+}
+}  // namespace
+
+// Usage: ParallelBFS [maps directory] [max nodes] [max seconds]
+//
+// Runs BFSSolverAgent and ParallelBFSSolverAgent with 1, 2, 4, ... threads up
+// to the number of hardware threads on each map, with the same bounds, and
+// prints the expanded nodes per second and the speedup over one thread.
+int main(int argc, char* argv[])
+{
+    const std::string mapsDir = argc > 1 ? argv[1] : MAPS_DIR;
+    const SearchLimits limits{
+        argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 200000,
+        argc > 3 ? std::strtod(argv[3], nullptr) : 60.0
+    };
+
+    std::vector<std::filesystem::path> maps;
+    for (const auto& entry : std::filesystem::directory_iterator(mapsDir))
+    {
+        if (entry.path().extension() == ".txt")
+        {
+            maps.emplace_back(entry.path());
+        }
+    }
+    std::sort(maps.begin(), maps.end());
+
+    std::vector<std::size_t> threadCounts{ 1 };
+    const std::size_t maxThreads =
+        std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+    while (threadCounts.back() * 2 <= maxThreads)
+    {
+        threadCounts.emplace_back(threadCounts.back() * 2);
+    }
+    if (threadCounts.back() != maxThreads)
+    {
+        threadCounts.emplace_back(maxThreads);
+    }
+
+    std::printf("%-18s %-8s %7s %6s %6s %10s %8s %12s %7s\n", "map", "agent",
+                "threads", "status", "length", "expanded", "seconds",
+                "nodes/s", "speedup");
+
+    for (const auto& path : maps)
+    {
+        const std::string name = path.filename().string();
+        const Game game(path.string());
+
+        BFSSolverAgent bfs(limits);
+        bfs.Solve(game);
+        PrintRow(name, "bfs", 1, bfs, 0.0);
+
+        double baseNodesPerSecond = 0.0;
+        for (const std::size_t numThreads : threadCounts)
+        {
+            ParallelBFSSolverAgent parallelBfs(numThreads, limits);
+            parallelBfs.Solve(game);
+
+            if (numThreads == 1)
+            {
+                baseNodesPerSecond = parallelBfs.GetStats().GetNodesPerSecond();
+            }
+            PrintRow(name, "parallel", numThreads, parallelBfs,
+                     baseNodesPerSecond);
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,115 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <baba-is-auto/Games/Game.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace baba_is_auto;
+
+namespace
+{
+//! A square as the map used to keep it: its own vector of objects, whose
+//! copy constructor copies the objects and then reserves room for 100.
+//! Resetting the map assigned a vector of them.
+struct LegacySquare
+{
+    LegacySquare() = default;
+
+    LegacySquare(const LegacySquare& other) : objects(other.objects)
+    {
+        objects.reserve(100);
+    }
+
+    LegacySquare& operator=(const LegacySquare& other) = default;
+
+    ObjectContainer objects;
+};
+
+template <typename Func>
+double MeasureNanoseconds(std::size_t numRepeats, Func&& func)
+{
+    const auto begin = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < numRepeats; ++i)
+    {
+        func();
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::nano>(end - begin).count() /
+           static_cast<double>(numRepeats);
+}
+}  // namespace
+
+// Usage: Reset [maps directory] [repeats]
+//
+// Plays some random steps on each map and measures one reset of it: the
+// legacy copy of a vector of squares, Map::Reset that copies the flat state
+// back, and Game::Reset that also copies the rules from the level template.
+int main(int argc, char* argv[])
+{
+    const std::string mapsDir = argc > 1 ? argv[1] : MAPS_DIR;
+    const std::size_t numRepeats =
+        argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 100000;
+
+    std::vector<std::filesystem::path> maps;
+    for (const auto& entry : std::filesystem::directory_iterator(mapsDir))
+    {
+        if (entry.path().extension() == ".txt")
+        {
+            maps.emplace_back(entry.path());
+        }
+    }
+    std::sort(maps.begin(), maps.end());
+
+    std::printf("%-18s %8s %12s %12s %12s %8s\n", "map", "objects",
+                "legacy(ns)", "map(ns)", "game(ns)", "speedup");
+
+    for (const auto& path : maps)
+    {
+        Game game(path.string());
+        Map& map = game.GetMap();
+
+        // The squares of the initial map in the legacy layout.
+        std::vector<LegacySquare> initSquares(map.GetWidth() *
+                                              map.GetHeight());
+        for (std::size_t y = 0; y < map.GetHeight(); ++y)
+        {
+            for (std::size_t x = 0; x < map.GetWidth(); ++x)
+            {
+                initSquares[y * map.GetWidth() + x].objects =
+                    map.GetObjects(x, y);
+            }
+        }
+        std::vector<LegacySquare> squares = initSquares;
+
+        std::mt19937 rng(0);
+        for (int step = 0; step < 20; ++step)
+        {
+            game.MovePlayer(static_cast<Direction>(1 + rng() % 4));
+        }
+
+        const double legacyNs = MeasureNanoseconds(
+            numRepeats, [&]() { squares = initSquares; });
+        const double mapNs =
+            MeasureNanoseconds(numRepeats, [&]() { map.Reset(); });
+        const double gameNs =
+            MeasureNanoseconds(numRepeats, [&]() { game.Reset(); });
+
+        std::printf("%-18s %8zu %12.1f %12.1f %12.1f %8.2f\n",
+                    path.filename().string().c_str(), map.GetNumObjects(),
+                    legacyNs, mapNs, gameNs, legacyNs / mapNs);
+    }
+
+    return EXIT_SUCCESS;
+}
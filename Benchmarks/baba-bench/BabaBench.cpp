@@ -0,0 +1,385 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <baba-is-auto/Agents/Preprocess.hpp>
+#include <baba-is-auto/Games/Game.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace baba_is_auto;
+
+namespace
+{
+//! The number of samples taken of each benchmark.
+constexpr std::size_t NUM_SAMPLES = 5;
+
+//! The number of steps after which an episode of random play is reset.
+constexpr std::size_t MAX_EPISODE_STEPS = 200;
+
+//! Keeps the results of the benchmarked calls alive.
+volatile std::uint64_t g_sink = 0;
+
+//! The names of the phases of a step, in the order of GamePhase.
+const char* const PHASE_NAMES[GameProfile::NUM_PHASES] = {
+    "STEP", "YOU",          "MOVE",   "SHIFT", "IS",
+    "SINK", "HOT_AND_MELT", "DEFEAT", "RULES", "PLAY_STATE"
+};
+
+//! The result of a benchmark on a map. The minimum is known for measured
+//! calls and the 99th percentile for profiled phases; the other one is
+//! negative and not written.
+struct BenchResult
+{
+    std::string name;
+    std::string map;
+    std::size_t iterations = 0;
+    double meanNs = 0.0;
+    double medianNs = 0.0;
+    double minNs = -1.0;
+    double p99Ns = -1.0;
+};
+
+//! Runs \p func as many times as fit in \p seconds, split in samples, and
+//! measures the time of a call.
+template <typename Func>
+BenchResult Measure(const std::string& name, const std::string& map,
+                    double seconds, Func&& func)
+{
+    using Clock = std::chrono::steady_clock;
+
+    const auto Run = [&func](std::size_t numIterations) {
+        const auto begin = Clock::now();
+        for (std::size_t i = 0; i < numIterations; ++i)
+        {
+            func();
+        }
+        return std::chrono::duration<double>(Clock::now() - begin).count();
+    };
+
+    // Doubles the number of calls until a sample takes long enough.
+    const double sampleSeconds = seconds / NUM_SAMPLES;
+    std::size_t numIterations = 1;
+    while (Run(numIterations) < sampleSeconds / 4 &&
+           numIterations < (std::size_t{ 1 } << 30))
+    {
+        numIterations *= 2;
+    }
+    numIterations *= 4;
+
+    std::vector<double> samples;
+    double totalSeconds = 0.0;
+    for (std::size_t i = 0; i < NUM_SAMPLES; ++i)
+    {
+        const double elapsed = Run(numIterations);
+        samples.emplace_back(elapsed * 1e9 /
+                             static_cast<double>(numIterations));
+        totalSeconds += elapsed;
+    }
+    std::sort(samples.begin(), samples.end());
+
+    BenchResult result;
+    result.name = name;
+    result.map = map;
+    result.iterations = numIterations * NUM_SAMPLES;
+    result.meanNs = totalSeconds * 1e9 / static_cast<double>(result.iterations);
+    result.medianNs = samples[NUM_SAMPLES / 2];
+    result.minNs = samples.front();
+
+    return result;
+}
+
+//! Plays \p game with the next random action, and resets it when the
+//! episode is over.
+void PlayRandomStep(Game& game, std::mt19937& rng, std::size_t& numSteps)
+{
+    if (game.GetPlayState() != PlayState::PLAYING ||
+        numSteps == MAX_EPISODE_STEPS)
+    {
+        game.Reset();
+        numSteps = 0;
+    }
+
+    game.MovePlayer(static_cast<Direction>(1 + rng() % 4));
+    ++numSteps;
+}
+
+void BenchMap(const std::filesystem::path& path, double seconds,
+              std::vector<BenchResult>& results)
+{
+    const std::string file = path.string();
+    const std::string name = path.filename().string();
+
+    results.emplace_back(Measure("Map::Load", name, seconds, [&]() {
+        Map map;
+        map.Load(file);
+        g_sink = g_sink + map.GetNumObjects();
+    }));
+
+    Game game(file);
+    Map& map = game.GetMap();
+
+    // Resets a map that has been played, as an environment does.
+    {
+        std::mt19937 rng(0);
+        std::size_t numSteps = 0;
+        for (std::size_t i = 0; i < 20; ++i)
+        {
+            PlayRandomStep(game, rng, numSteps);
+        }
+    }
+    results.emplace_back(Measure("Map::Reset", name, seconds, [&]() {
+        map.Reset();
+        g_sink = g_sink + map.GetHash();
+    }));
+
+    // Takes and restores the snapshots of a played game, as searches do.
+    {
+        std::mt19937 rng(0);
+        std::size_t numSteps = 0;
+        for (std::size_t i = 0; i < 20; ++i)
+        {
+            PlayRandomStep(game, rng, numSteps);
+        }
+    }
+    GameSnapshot snapshot = game.Snapshot();
+    results.emplace_back(Measure("Game::Snapshot", name, seconds, [&]() {
+        game.Snapshot(snapshot);
+        g_sink = g_sink + snapshot.size();
+    }));
+    results.emplace_back(Measure("Game::Restore", name, seconds, [&]() {
+        game.Restore(snapshot);
+        g_sink = g_sink + game.Hash();
+    }));
+    results.emplace_back(
+        Measure("Game::RestoreTrusted", name, seconds, [&]() {
+            game.RestoreTrusted(snapshot);
+            g_sink = g_sink + game.Hash();
+        }));
+
+    game.Reset();
+    Map ruleMap = game.GetMap();
+    RuleManager ruleManager;
+    results.emplace_back(
+        Measure("RuleManager::ParseRules", name, seconds, [&]() {
+            ruleManager.ParseRules(ruleMap);
+            g_sink = g_sink + ruleManager.GetNumRules();
+        }));
+
+    // Asks each object on the map for each property, as the phases do.
+    std::vector<ObjectType> types;
+    for (std::size_t y = 0; y < ruleMap.GetHeight(); ++y)
+    {
+        for (std::size_t x = 0; x < ruleMap.GetWidth(); ++x)
+        {
+            for (const ObjectSlot slot : ruleMap.GetSlots(x, y))
+            {
+                types.emplace_back(ruleMap.GetType(slot));
+            }
+        }
+    }
+    std::vector<ObjectType> properties;
+    for (auto type = static_cast<std::size_t>(ObjectType::PROPERTY_TYPE) + 1;
+         type < static_cast<std::size_t>(ObjectType::ICON_TYPE); ++type)
+    {
+        properties.emplace_back(static_cast<ObjectType>(type));
+    }
+    std::size_t typeIdx = 0;
+    std::size_t propertyIdx = 0;
+    results.emplace_back(Measure("RuleManager::HasType", name, seconds, [&]() {
+        g_sink = g_sink + ruleManager.HasType(types[typeIdx],
+                                              properties[propertyIdx]);
+        if (++typeIdx == types.size())
+        {
+            typeIdx = 0;
+            propertyIdx = (propertyIdx + 1) % properties.size();
+        }
+    }));
+
+    {
+        std::mt19937 rng(0);
+        std::size_t numSteps = 0;
+        game.Reset();
+        results.emplace_back(
+            Measure("Game::MovePlayer", name, seconds, [&]() {
+                PlayRandomStep(game, rng, numSteps);
+                g_sink = g_sink + static_cast<std::uint64_t>(
+                                      game.GetPlayState());
+            }));
+    }
+
+    // Profiles the phases of the steps for as long as a benchmark takes.
+    {
+        using Clock = std::chrono::steady_clock;
+
+        std::mt19937 rng(0);
+        std::size_t numSteps = 0;
+        game.Reset();
+        game.SetProfiling(true);
+        game.ResetProfile();
+
+        const auto begin = Clock::now();
+        while (std::chrono::duration<double>(Clock::now() - begin).count() <
+               seconds)
+        {
+            for (std::size_t i = 0; i < 64; ++i)
+            {
+                PlayRandomStep(game, rng, numSteps);
+            }
+        }
+        game.SetProfiling(false);
+
+        const GameProfile& profile = game.GetProfile();
+        for (std::size_t idx = 0; idx < GameProfile::NUM_PHASES; ++idx)
+        {
+            const auto phase = static_cast<GamePhase>(idx);
+
+            BenchResult result;
+            result.name = std::string("Game::MovePlayer/") + PHASE_NAMES[idx];
+            result.map = name;
+            result.iterations =
+                static_cast<std::size_t>(profile.GetNumCalls(phase));
+            result.meanNs = profile.GetMeanNanoseconds(phase);
+            result.medianNs = profile.GetPercentileNanoseconds(phase, 50.0);
+            result.p99Ns = profile.GetPercentileNanoseconds(phase, 99.0);
+            results.emplace_back(result);
+        }
+    }
+
+    std::vector<float> tensor(Preprocess::GetTensorSize(game));
+    results.emplace_back(
+        Measure("Preprocess::StateToTensor", name, seconds, [&]() {
+            Preprocess::StateToTensor(game, tensor.data());
+            g_sink = g_sink + static_cast<std::uint64_t>(tensor[0]);
+        }));
+}
+
+//! Writes \p str as a JSON string. Map names are file names, so only quotes
+//! and backslashes are escaped.
+void WriteString(std::FILE* out, const std::string& str)
+{
+    std::fputc('"', out);
+    for (const char ch : str)
+    {
+        if (ch == '"' || ch == '\\')
+        {
+            std::fputc('\\', out);
+        }
+        std::fputc(ch, out);
+    }
+    std::fputc('"', out);
+}
+
+void WriteJson(std::FILE* out, double seconds,
+               const std::vector<BenchResult>& results)
+{
+    std::fprintf(out, "{\n");
+    std::fprintf(out, "  \"context\": {\n");
+#if defined(__clang__)
+    std::fprintf(out, "    \"compiler\": \"clang %s\",\n", __clang_version__);
+#elif defined(__GNUC__)
+    std::fprintf(out, "    \"compiler\": \"gcc %s\",\n", __VERSION__);
+#elif defined(_MSC_VER)
+    std::fprintf(out, "    \"compiler\": \"msvc %d\",\n", _MSC_VER);
+#else
+    std::fprintf(out, "    \"compiler\": \"unknown\",\n");
+#endif
+#ifdef NDEBUG
+    std::fprintf(out, "    \"build_type\": \"release\",\n");
+#else
+    std::fprintf(out, "    \"build_type\": \"debug\",\n");
+#endif
+    std::fprintf(out, "    \"hardware_threads\": %u,\n",
+                 std::thread::hardware_concurrency());
+    std::fprintf(out, "    \"seconds_per_benchmark\": %g,\n", seconds);
+    std::fprintf(out, "    \"samples\": %zu\n", NUM_SAMPLES);
+    std::fprintf(out, "  },\n");
+
+    std::fprintf(out, "  \"benchmarks\": [\n");
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+        const BenchResult& result = results[i];
+
+        std::fprintf(out, "    {\"name\": ");
+        WriteString(out, result.name);
+        std::fprintf(out, ", \"map\": ");
+        WriteString(out, result.map);
+        std::fprintf(out,
+                     ", \"iterations\": %zu, \"mean_ns\": %.2f, "
+                     "\"median_ns\": %.2f",
+                     result.iterations, result.meanNs, result.medianNs);
+        if (result.minNs >= 0.0)
+        {
+            std::fprintf(out, ", \"min_ns\": %.2f", result.minNs);
+        }
+        if (result.p99Ns >= 0.0)
+        {
+            std::fprintf(out, ", \"p99_ns\": %.2f", result.p99Ns);
+        }
+        std::fprintf(out, "}%s\n", i + 1 < results.size() ? "," : "");
+    }
+    std::fprintf(out, "  ]\n");
+    std::fprintf(out, "}\n");
+}
+}  // namespace
+
+// Usage: baba-bench [maps directory] [seconds per benchmark] [output file]
+//
+// Runs the microbenchmarks of loading and resetting a map, taking and
+// restoring snapshots, parsing and asking rules, stepping a game and
+// converting it to a tensor on each map, and profiles the phases of the
+// steps. Writes the time of a call of each
+// as JSON to the output file, or to the standard output.
+int main(int argc, char* argv[])
+{
+    const std::string mapsDir = argc > 1 ? argv[1] : MAPS_DIR;
+    const double seconds = argc > 2 ? std::strtod(argv[2], nullptr) : 0.5;
+
+    std::vector<std::filesystem::path> maps;
+    for (const auto& entry : std::filesystem::directory_iterator(mapsDir))
+    {
+        if (entry.path().extension() == ".txt")
+        {
+            maps.emplace_back(entry.path());
+        }
+    }
+    std::sort(maps.begin(), maps.end());
+
+    std::vector<BenchResult> results;
+    for (const auto& path : maps)
+    {
+        std::fprintf(stderr, "%s\n", path.filename().string().c_str());
+        BenchMap(path, seconds, results);
+    }
+
+    std::FILE* out = stdout;
+    if (argc > 3)
+    {
+        out = std::fopen(argv[3], "w");
+        if (out == nullptr)
+        {
+            std::fprintf(stderr, "Can not open %s.\n", argv[3]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    WriteJson(out, seconds, results);
+
+    if (out != stdout)
+    {
+        std::fclose(out);
+    }
+
+    return EXIT_SUCCESS;
+}
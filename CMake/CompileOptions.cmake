@@ -51,6 +51,14 @@ set(DEFAULT_COMPILE_DEFINITIONS
 	SYSTEM_${SYSTEM_NAME_UPPER}
 )
 
+# Tracing - compiled out unless enabled
+option(BABA_IS_AUTO_ENABLE_TRACE "Build with the tracing subsystem" OFF)
+if (BABA_IS_AUTO_ENABLE_TRACE)
+	set(DEFAULT_COMPILE_DEFINITIONS ${DEFAULT_COMPILE_DEFINITIONS}
+		BABA_IS_AUTO_ENABLE_TRACE
+	)
+endif ()
+
 # MSVC compiler options
 if (CMAKE_CXX_COMPILER_ID MATCHES "MSVC")
 	set(DEFAULT_COMPILE_DEFINITIONS ${DEFAULT_COMPILE_DEFINITIONS}
@@ -5,6 +5,7 @@ import sys
 import sprites
 
 game = pyBaba.Game("../../Resources/Maps/out_of_reach.txt")
+game.SetRecordEvents(True)
 screen_size = (game.GetMap().GetWidth() * config.BLOCK_SIZE,
                game.GetMap().GetHeight() * config.BLOCK_SIZE)
 screen = pygame.display.set_mode(
@@ -31,11 +32,34 @@ def draw_obj(x_pos, y_pos):
 
 
 def draw():
+    screen.fill(config.COLOR_BACKGROUND)
     for y_pos in range(game.GetMap().GetHeight()):
         for x_pos in range(game.GetMap().GetWidth()):
             draw_obj(x_pos, y_pos)
 
 
+def draw_cell(x_pos, y_pos):
+    screen.fill(config.COLOR_BACKGROUND,
+                (x_pos * config.BLOCK_SIZE, y_pos * config.BLOCK_SIZE,
+                 config.BLOCK_SIZE, config.BLOCK_SIZE))
+    draw_obj(x_pos, y_pos)
+
+
+def draw_events():
+    # Only the squares that the last step has changed are drawn again.
+    cells = set()
+    for event in game.GetEvents():
+        if event.type == pyBaba.StepEventType.MOVED:
+            cells.add((event.x, event.y))
+            cells.add((event.toX, event.toY))
+        elif event.type in (pyBaba.StepEventType.REMOVED,
+                            pyBaba.StepEventType.TYPE_CHANGED):
+            cells.add((event.x, event.y))
+
+    for x_pos, y_pos in cells:
+        draw_cell(x_pos, y_pos)
+
+
 if __name__ == '__main__':
     pygame.init()
     pygame.font.init()
@@ -53,6 +77,8 @@ if __name__ == '__main__':
     game_over = False
     time_step = 0
 
+    draw()
+
     while True:
         if game_over:
             for event in pygame.event.get():
@@ -73,6 +99,7 @@ if __name__ == '__main__':
             if event.type == pygame.USEREVENT:
                 if time_step < len(actions):
                     game.MovePlayer(action_dic[actions[time_step]])
+                    draw_events()
                     time_step += 1
                 else:
                     pass
@@ -84,8 +111,6 @@ if __name__ == '__main__':
         if game.GetPlayState() == pyBaba.PlayState.WON or game.GetPlayState() == pyBaba.PlayState.LOST:
             game_over = True
 
-        screen.fill(config.COLOR_BACKGROUND)
-        draw()
         pygame.display.flip()
 
         clock.tick(config.FPS)
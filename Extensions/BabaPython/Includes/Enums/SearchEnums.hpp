@@ -0,0 +1,14 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef BABA_IS_AUTO_PYTHON_SEARCH_ENUMS_HPP
+#define BABA_IS_AUTO_PYTHON_SEARCH_ENUMS_HPP
+
+#include <pybind11/pybind11.h>
+
+void AddSearchEnums(pybind11::module& m);
+
+#endif  // BABA_IS_AUTO_PYTHON_SEARCH_ENUMS_HPP
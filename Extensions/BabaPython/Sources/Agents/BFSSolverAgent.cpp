@@ -0,0 +1,20 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Agents/BFSSolverAgent.hpp>
+#include <baba-is-auto/Agents/BFSSolverAgent.hpp>
+
+#include <pybind11/pybind11.h>
+
+using namespace baba_is_auto;
+
+void AddBFSSolverAgent(pybind11::module& m)
+{
+    pybind11::class_<BFSSolverAgent, SolverAgent,
+                     std::shared_ptr<BFSSolverAgent>>(m, "BFSSolverAgent")
+        .def(pybind11::init<>())
+        .def(pybind11::init<SearchLimits>());
+}
@@ -0,0 +1,30 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Agents/HeuristicSearchAgent.hpp>
+#include <baba-is-auto/Agents/HeuristicSearchAgent.hpp>
+
+#include <pybind11/pybind11.h>
+
+using namespace baba_is_auto;
+
+void AddHeuristicSearchAgent(pybind11::module& m)
+{
+    pybind11::class_<HeuristicSearchAgent, SolverAgent,
+                     std::shared_ptr<HeuristicSearchAgent>>(
+        m, "HeuristicSearchAgent")
+        .def(pybind11::init([](SearchAlgorithm algorithm,
+                               std::shared_ptr<IHeuristic> heuristic,
+                               SearchLimits limits) {
+                 // A null heuristic is the default one, as in C++.
+                 return std::make_shared<HeuristicSearchAgent>(
+                     algorithm, std::move(heuristic), limits);
+             }),
+             pybind11::arg("algorithm") = SearchAlgorithm::A_STAR,
+             pybind11::arg("heuristic") = nullptr,
+             pybind11::arg("limits") = SearchLimits())
+        .def("GetAlgorithm", &HeuristicSearchAgent::GetAlgorithm);
+}
@@ -0,0 +1,62 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Agents/Heuristics.hpp>
+#include <baba-is-auto/Agents/Heuristics.hpp>
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+using namespace baba_is_auto;
+
+class PyHeuristic : public IHeuristic
+{
+ public:
+    using IHeuristic::IHeuristic;
+
+    int Estimate(const Game& game) const override
+    {
+        PYBIND11_OVERRIDE_PURE(int, IHeuristic, Estimate, game);
+    }
+};
+
+void AddHeuristics(pybind11::module& m)
+{
+    pybind11::class_<IHeuristic, PyHeuristic, std::shared_ptr<IHeuristic>>(
+        m, "IHeuristic")
+        .def(pybind11::init<>())
+        .def("Estimate", &IHeuristic::Estimate);
+
+    pybind11::class_<ZeroHeuristic, IHeuristic,
+                     std::shared_ptr<ZeroHeuristic>>(m, "ZeroHeuristic")
+        .def(pybind11::init<>());
+
+    pybind11::class_<YouToWinDistanceHeuristic, IHeuristic,
+                     std::shared_ptr<YouToWinDistanceHeuristic>>(
+        m, "YouToWinDistanceHeuristic")
+        .def(pybind11::init<>());
+
+    pybind11::class_<RuleTextDistanceHeuristic, IHeuristic,
+                     std::shared_ptr<RuleTextDistanceHeuristic>>(
+        m, "RuleTextDistanceHeuristic")
+        .def(pybind11::init<>());
+
+    pybind11::class_<MaxHeuristic, IHeuristic, std::shared_ptr<MaxHeuristic>>(
+        m, "MaxHeuristic")
+        .def(pybind11::init([](std::vector<std::shared_ptr<IHeuristic>> list) {
+            return std::make_shared<MaxHeuristic>(
+                std::vector<std::shared_ptr<const IHeuristic>>(list.begin(),
+                                                               list.end()));
+        }));
+
+    m.def("MakeDefaultHeuristic", []() {
+        return std::const_pointer_cast<IHeuristic>(MakeDefaultHeuristic());
+    });
+
+    m.def("MakeGuidedHeuristic", []() {
+        return std::const_pointer_cast<IHeuristic>(MakeGuidedHeuristic());
+    });
+}
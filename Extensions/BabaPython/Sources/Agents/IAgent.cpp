@@ -13,5 +13,7 @@ using namespace baba_is_auto;
 
 void AddIAgent(pybind11::module& m)
 {
-    pybind11::class_<IAgent>(m, "IAgent");
+    // Agents are held by std::shared_ptr, so that they can be given to
+    // RolloutEngine by an agent factory.
+    pybind11::class_<IAgent, std::shared_ptr<IAgent>>(m, "IAgent");
 }
\ No newline at end of file
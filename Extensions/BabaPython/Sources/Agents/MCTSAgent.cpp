@@ -0,0 +1,74 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Agents/MCTSAgent.hpp>
+#include <baba-is-auto/Agents/MCTSAgent.hpp>
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+using namespace baba_is_auto;
+
+void AddMCTSAgent(pybind11::module& m)
+{
+    pybind11::class_<MCTSOptions>(m, "MCTSOptions")
+        .def(pybind11::init<>())
+        .def(pybind11::init([](std::size_t maxIterations, double maxSeconds,
+                               std::size_t rolloutDepth,
+                               double explorationConstant,
+                               std::size_t numThreads,
+                               MCTSParallelism parallelism, int virtualLoss,
+                               std::uint64_t seed) {
+                 return MCTSOptions{ maxIterations, maxSeconds,
+                                     rolloutDepth,  explorationConstant,
+                                     numThreads,    parallelism,
+                                     virtualLoss,   seed };
+             }),
+             pybind11::arg("maxIterations") = 1000,
+             pybind11::arg("maxSeconds") = 0.0,
+             pybind11::arg("rolloutDepth") = 50,
+             pybind11::arg("explorationConstant") = 1.41421356,
+             pybind11::arg("numThreads") = 1,
+             pybind11::arg("parallelism") = MCTSParallelism::TREE,
+             pybind11::arg("virtualLoss") = 1, pybind11::arg("seed") = 0)
+        .def_readwrite("maxIterations", &MCTSOptions::maxIterations)
+        .def_readwrite("maxSeconds", &MCTSOptions::maxSeconds)
+        .def_readwrite("rolloutDepth", &MCTSOptions::rolloutDepth)
+        .def_readwrite("explorationConstant",
+                       &MCTSOptions::explorationConstant)
+        .def_readwrite("numThreads", &MCTSOptions::numThreads)
+        .def_readwrite("parallelism", &MCTSOptions::parallelism)
+        .def_readwrite("virtualLoss", &MCTSOptions::virtualLoss)
+        .def_readwrite("seed", &MCTSOptions::seed);
+
+    pybind11::class_<MCTSStats>(m, "MCTSStats")
+        .def(pybind11::init<>())
+        .def_readonly("iterations", &MCTSStats::iterations)
+        .def_readonly("rollouts", &MCTSStats::rollouts)
+        .def_readonly("rolloutSteps", &MCTSStats::rolloutSteps)
+        .def_readonly("treeNodes", &MCTSStats::treeNodes)
+        .def_readonly("numThreads", &MCTSStats::numThreads)
+        .def_readonly("elapsedSeconds", &MCTSStats::elapsedSeconds)
+        .def("GetRolloutsPerSecond", &MCTSStats::GetRolloutsPerSecond)
+        .def("GetRolloutsPerSecondPerThread",
+             &MCTSStats::GetRolloutsPerSecondPerThread);
+
+    // The search runs on other threads that may call back into a heuristic
+    // written in Python, so the GIL is released while it runs.
+    pybind11::class_<MCTSAgent, IAgent, std::shared_ptr<MCTSAgent>>(
+        m, "MCTSAgent")
+        .def(pybind11::init<MCTSOptions, std::shared_ptr<IHeuristic>>(),
+             pybind11::arg("options") = MCTSOptions(),
+             pybind11::arg("heuristic") = nullptr)
+        .def("Search", &MCTSAgent::Search,
+             pybind11::call_guard<pybind11::gil_scoped_release>())
+        .def("GetAction", &MCTSAgent::GetAction,
+             pybind11::call_guard<pybind11::gil_scoped_release>())
+        .def("GetRootVisits", &MCTSAgent::GetRootVisits)
+        .def("GetRootValues", &MCTSAgent::GetRootValues)
+        .def("GetStats", &MCTSAgent::GetStats)
+        .def("GetOptions", &MCTSAgent::GetOptions);
+}
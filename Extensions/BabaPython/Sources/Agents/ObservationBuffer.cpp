@@ -0,0 +1,53 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Agents/ObservationBuffer.hpp>
+#include <baba-is-auto/Agents/ObservationBuffer.hpp>
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+
+using namespace baba_is_auto;
+
+void AddObservationBuffer(pybind11::module& m)
+{
+    // numpy.asarray(buffer) is a (C, H, W) float32 view of the buffer, and
+    // it changes with each call of Update.
+    pybind11::class_<ObservationBuffer>(m, "ObservationBuffer",
+                                        pybind11::buffer_protocol())
+        .def(pybind11::init(
+                 [](const Game& game,
+                    std::shared_ptr<ObservationEncoder> encoder) {
+                     return std::make_unique<ObservationBuffer>(
+                         game, std::move(encoder));
+                 }),
+             pybind11::arg("game"), pybind11::arg("encoder") = nullptr)
+        .def(pybind11::init([](std::size_t width, std::size_t height,
+                               std::shared_ptr<ObservationEncoder> encoder) {
+                 return std::make_unique<ObservationBuffer>(
+                     width, height, std::move(encoder));
+             }),
+             pybind11::arg("width"), pybind11::arg("height"),
+             pybind11::arg("encoder") = nullptr)
+        .def_buffer([](ObservationBuffer& buffer) {
+            const auto height = static_cast<pybind11::ssize_t>(buffer.GetHeight());
+            const auto width = static_cast<pybind11::ssize_t>(buffer.GetWidth());
+            const auto floatSize = static_cast<pybind11::ssize_t>(sizeof(float));
+
+            return pybind11::buffer_info(
+                buffer.GetData(), sizeof(float),
+                pybind11::format_descriptor<float>::format(), 3,
+                { static_cast<pybind11::ssize_t>(buffer.GetNumChannels()),
+                  height, width },
+                { height * width * floatSize, width * floatSize, floatSize });
+        })
+        .def("Update", &ObservationBuffer::Update)
+        .def("UpdateChanges", &ObservationBuffer::UpdateChanges)
+        .def("GetNumChannels", &ObservationBuffer::GetNumChannels)
+        .def("GetHeight", &ObservationBuffer::GetHeight)
+        .def("GetWidth", &ObservationBuffer::GetWidth)
+        .def("GetSize", &ObservationBuffer::GetSize);
+}
@@ -0,0 +1,93 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Agents/ObservationEncoder.hpp>
+#include <baba-is-auto/Agents/ObservationEncoder.hpp>
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <stdexcept>
+
+using namespace baba_is_auto;
+
+void AddObservationEncoder(pybind11::module& m)
+{
+    using FloatArray = pybind11::array_t<float, pybind11::array::c_style>;
+
+    pybind11::class_<EncoderSpec>(m, "EncoderSpec")
+        .def(pybind11::init<>())
+        .def_readwrite("typeChannels", &EncoderSpec::typeChannels)
+        .def_readwrite("hasTextPlane", &EncoderSpec::hasTextPlane)
+        .def_readwrite("hasRulePlane", &EncoderSpec::hasRulePlane)
+        .def_readwrite("propertyPlanes", &EncoderSpec::propertyPlanes);
+
+    pybind11::class_<ObservationEncoder,
+                     std::shared_ptr<ObservationEncoder>>(m,
+                                                          "ObservationEncoder")
+        .def(pybind11::init<EncoderSpec>())
+        .def_static("MakeDefaultSpec", &ObservationEncoder::MakeDefaultSpec)
+        .def_static("MakeFullSpec", &ObservationEncoder::MakeFullSpec,
+                    pybind11::arg("hasPropertyPlanes") = true)
+        // The default encoder is a static, so Python does not own it.
+        .def_static("GetDefault",
+                    []() {
+                        return std::shared_ptr<ObservationEncoder>(
+                            std::shared_ptr<ObservationEncoder>(),
+                            const_cast<ObservationEncoder*>(
+                                &ObservationEncoder::GetDefault()));
+                    })
+        .def("GetSpec", &ObservationEncoder::GetSpec)
+        .def("GetNumChannels", &ObservationEncoder::GetNumChannels)
+        .def("GetChannel", &ObservationEncoder::GetChannel)
+        .def("GetTensorSize", &ObservationEncoder::GetTensorSize)
+        // Writes the tensor into a new (C, H, W) float32 array.
+        .def("Encode",
+             [](const ObservationEncoder& encoder, const Game& game) {
+                 FloatArray array({
+                     static_cast<pybind11::ssize_t>(encoder.GetNumChannels()),
+                     static_cast<pybind11::ssize_t>(game.GetMap().GetHeight()),
+                     static_cast<pybind11::ssize_t>(game.GetMap().GetWidth()),
+                 });
+
+                 encoder.Encode(game, array.mutable_data());
+                 return array;
+             })
+        // Writes the tensor into out, a C-contiguous float32 array of
+        // GetTensorSize(game) elements, without a copy.
+        .def(
+            "Encode",
+            [](const ObservationEncoder& encoder, const Game& game,
+               FloatArray& out) {
+                if (static_cast<std::size_t>(out.size()) !=
+                    encoder.GetTensorSize(game))
+                {
+                    throw std::invalid_argument(
+                        "ObservationEncoder - The size of out does not "
+                        "match.");
+                }
+
+                encoder.Encode(game, out.mutable_data());
+            },
+            pybind11::arg("game"), pybind11::arg("out").noconvert())
+        // Patches out, which holds the tensor of game before its last step.
+        .def(
+            "EncodeChanges",
+            [](const ObservationEncoder& encoder, const Game& game,
+               FloatArray& out) {
+                if (static_cast<std::size_t>(out.size()) !=
+                    encoder.GetTensorSize(game))
+                {
+                    throw std::invalid_argument(
+                        "ObservationEncoder - The size of out does not "
+                        "match.");
+                }
+
+                encoder.EncodeChanges(game, out.mutable_data());
+            },
+            pybind11::arg("game"), pybind11::arg("out").noconvert());
+}
@@ -0,0 +1,23 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Agents/ParallelBFSSolverAgent.hpp>
+#include <baba-is-auto/Agents/ParallelBFSSolverAgent.hpp>
+
+#include <pybind11/pybind11.h>
+
+using namespace baba_is_auto;
+
+void AddParallelBFSSolverAgent(pybind11::module& m)
+{
+    pybind11::class_<ParallelBFSSolverAgent, SolverAgent,
+                     std::shared_ptr<ParallelBFSSolverAgent>>(
+        m, "ParallelBFSSolverAgent")
+        .def(pybind11::init<std::size_t, SearchLimits>(),
+             pybind11::arg("numThreads") = 0,
+             pybind11::arg("limits") = SearchLimits())
+        .def("GetNumThreads", &ParallelBFSSolverAgent::GetNumThreads);
+}
@@ -7,14 +7,52 @@
 #include <Agents/Preprocess.hpp>
 #include <baba-is-auto/Agents/Preprocess.hpp>
 
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
+#include <stdexcept>
+
 using namespace baba_is_auto;
 
 void AddPreprocess(pybind11::module& m)
 {
+    using FloatArray = pybind11::array_t<float, pybind11::array::c_style>;
+
     pybind11::class_<Preprocess>(m, "Preprocess")
-        .def_static("StateToTensor", &Preprocess::StateToTensor)
+        .def_static("StateToTensor",
+                    static_cast<std::vector<float> (*)(const Game&)>(
+                        &Preprocess::StateToTensor))
+        // Writes the tensor into out, a C-contiguous float32 array of
+        // GetTensorSize(game) elements, without a copy.
+        .def_static(
+            "StateToTensor",
+            [](const Game& game, FloatArray& out) {
+                if (static_cast<std::size_t>(out.size()) !=
+                    Preprocess::GetTensorSize(game))
+                {
+                    throw std::invalid_argument(
+                        "Preprocess - The size of out does not match.");
+                }
+
+                Preprocess::StateToTensor(game, out.mutable_data());
+            },
+            pybind11::arg("game"), pybind11::arg("out").noconvert())
+        // Writes the tensor into a new (C, H, W) float32 array.
+        .def_static("StateToArray",
+                    [](const Game& game) {
+                        FloatArray array({
+                            static_cast<pybind11::ssize_t>(
+                                Preprocess::TENSOR_DIM),
+                            static_cast<pybind11::ssize_t>(
+                                game.GetMap().GetHeight()),
+                            static_cast<pybind11::ssize_t>(
+                                game.GetMap().GetWidth()),
+                        });
+
+                        Preprocess::StateToTensor(game, array.mutable_data());
+                        return array;
+                    })
+        .def_static("GetTensorSize", &Preprocess::GetTensorSize)
         .def_readonly_static("TENSOR_DIM", &Preprocess::TENSOR_DIM);
-}
\ No newline at end of file
+}
@@ -13,7 +13,8 @@ using namespace baba_is_auto;
 
 void AddRandomAgent(pybind11::module& m)
 {
-    pybind11::class_<RandomAgent>(m, "RandomAgent")
+    pybind11::class_<RandomAgent, IAgent, std::shared_ptr<RandomAgent>>(
+        m, "RandomAgent")
         .def(pybind11::init<>())
         .def("GetAction", &RandomAgent::GetAction);
 }
\ No newline at end of file
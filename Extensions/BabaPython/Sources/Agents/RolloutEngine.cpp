@@ -0,0 +1,61 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Agents/RolloutEngine.hpp>
+#include <baba-is-auto/Agents/RolloutEngine.hpp>
+
+#include <pybind11/functional.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+using namespace baba_is_auto;
+
+void AddRolloutEngine(pybind11::module& m)
+{
+    pybind11::class_<RolloutOptions>(m, "RolloutOptions")
+        .def(pybind11::init<>())
+        .def(pybind11::init([](std::size_t numPlayouts, std::size_t maxDepth,
+                               std::size_t numThreads, std::uint64_t seed) {
+                 return RolloutOptions{ numPlayouts, maxDepth, numThreads,
+                                        seed };
+             }),
+             pybind11::arg("numPlayouts") = 1000,
+             pybind11::arg("maxDepth") = 50,
+             pybind11::arg("numThreads") = 1, pybind11::arg("seed") = 0)
+        .def_readwrite("numPlayouts", &RolloutOptions::numPlayouts)
+        .def_readwrite("maxDepth", &RolloutOptions::maxDepth)
+        .def_readwrite("numThreads", &RolloutOptions::numThreads)
+        .def_readwrite("seed", &RolloutOptions::seed);
+
+    pybind11::class_<RolloutStats>(m, "RolloutStats")
+        .def(pybind11::init<>())
+        .def_readonly("numPlayouts", &RolloutStats::numPlayouts)
+        .def_readonly("numWins", &RolloutStats::numWins)
+        .def_readonly("numLosses", &RolloutStats::numLosses)
+        .def_readonly("numUnfinished", &RolloutStats::numUnfinished)
+        .def_readonly("totalSteps", &RolloutStats::totalSteps)
+        .def_readonly("totalWinSteps", &RolloutStats::totalWinSteps)
+        .def_readonly("minWinSteps", &RolloutStats::minWinSteps)
+        .def_readonly("maxSteps", &RolloutStats::maxSteps)
+        .def_readonly("numThreads", &RolloutStats::numThreads)
+        .def_readonly("elapsedSeconds", &RolloutStats::elapsedSeconds)
+        .def("GetWinRate", &RolloutStats::GetWinRate)
+        .def("GetLossRate", &RolloutStats::GetLossRate)
+        .def("GetMeanSteps", &RolloutStats::GetMeanSteps)
+        .def("GetMeanWinSteps", &RolloutStats::GetMeanWinSteps)
+        .def("GetStepsPerSecond", &RolloutStats::GetStepsPerSecond);
+
+    // The agent factory is called by the constructor, with the GIL held.
+    // The playouts run on other threads, so the GIL is released while they
+    // run.
+    pybind11::class_<RolloutEngine>(m, "RolloutEngine")
+        .def(pybind11::init<RolloutOptions, RolloutEngine::AgentFactory>(),
+             pybind11::arg("options") = RolloutOptions(),
+             pybind11::arg("agentFactory") = nullptr)
+        .def("Run", &RolloutEngine::Run,
+             pybind11::call_guard<pybind11::gil_scoped_release>())
+        .def("GetOptions", &RolloutEngine::GetOptions);
+}
@@ -0,0 +1,44 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Agents/SolverAgent.hpp>
+#include <baba-is-auto/Agents/SolverAgent.hpp>
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+using namespace baba_is_auto;
+
+void AddSolverAgent(pybind11::module& m)
+{
+    pybind11::class_<SearchLimits>(m, "SearchLimits")
+        .def(pybind11::init<>())
+        .def(pybind11::init([](std::size_t maxNodes, double maxSeconds) {
+                 return SearchLimits{ maxNodes, maxSeconds };
+             }),
+             pybind11::arg("maxNodes") = 0, pybind11::arg("maxSeconds") = 0.0)
+        .def_readwrite("maxNodes", &SearchLimits::maxNodes)
+        .def_readwrite("maxSeconds", &SearchLimits::maxSeconds);
+
+    pybind11::class_<SearchStats>(m, "SearchStats")
+        .def(pybind11::init<>())
+        .def_readonly("nodesExpanded", &SearchStats::nodesExpanded)
+        .def_readonly("nodesGenerated", &SearchStats::nodesGenerated)
+        .def_readonly("statesVisited", &SearchStats::statesVisited)
+        .def_readonly("memoryBytes", &SearchStats::memoryBytes)
+        .def_readonly("elapsedSeconds", &SearchStats::elapsedSeconds)
+        .def("GetNodesPerSecond", &SearchStats::GetNodesPerSecond);
+
+    pybind11::class_<SolverAgent, IAgent, std::shared_ptr<SolverAgent>>(
+        m, "SolverAgent")
+        .def("Solve", &SolverAgent::Solve)
+        .def("GetAction", &SolverAgent::GetAction)
+        .def("GetSolution", &SolverAgent::GetSolution)
+        .def("GetStats", &SolverAgent::GetStats)
+        .def("GetStatus", &SolverAgent::GetStatus)
+        .def("GetLimits", &SolverAgent::GetLimits)
+        .def("SetLimits", &SolverAgent::SetLimits);
+}
@@ -40,6 +40,35 @@ void AddGameEnums(pybind11::module& m)
         .value("LEFT", Direction::LEFT)
         .value("RIGHT", Direction::RIGHT)
         .export_values();
+
+    pybind11::enum_<StepEventType>(m, "StepEventType")
+        .value("MOVED", StepEventType::MOVED)
+        .value("REMOVED", StepEventType::REMOVED)
+        .value("TYPE_CHANGED", StepEventType::TYPE_CHANGED)
+        .value("RULE_ADDED", StepEventType::RULE_ADDED)
+        .value("RULE_REMOVED", StepEventType::RULE_REMOVED)
+        .value("PLAY_STATE_CHANGED", StepEventType::PLAY_STATE_CHANGED)
+        .export_values();
+
+    // The names of the phases are the names of properties as well, so they
+    // are not exported to the module.
+    pybind11::enum_<GamePhase>(m, "GamePhase")
+        .value("STEP", GamePhase::STEP)
+        .value("YOU", GamePhase::YOU)
+        .value("MOVE", GamePhase::MOVE)
+        .value("SHIFT", GamePhase::SHIFT)
+        .value("IS", GamePhase::IS)
+        .value("SINK", GamePhase::SINK)
+        .value("HOT_AND_MELT", GamePhase::HOT_AND_MELT)
+        .value("DEFEAT", GamePhase::DEFEAT)
+        .value("RULES", GamePhase::RULES)
+        .value("PLAY_STATE", GamePhase::PLAY_STATE);
+
+    pybind11::enum_<GameCounter>(m, "GameCounter")
+        .value("HAS_TYPE", GameCounter::HAS_TYPE)
+        .value("CAN_MOVE", GameCounter::CAN_MOVE)
+        .value("MOVABLE_BOARDS", GameCounter::MOVABLE_BOARDS)
+        .value("OBJECTS_SCANNED", GameCounter::OBJECTS_SCANNED);
 }
 
 void AddGameEnumUtils(pybind11::module& m)
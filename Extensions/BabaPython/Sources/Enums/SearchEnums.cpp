@@ -0,0 +1,32 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Enums/SearchEnums.hpp>
+#include <baba-is-auto/Enums/SearchEnums.hpp>
+
+#include <pybind11/pybind11.h>
+
+using namespace baba_is_auto;
+
+void AddSearchEnums(pybind11::module& m)
+{
+    pybind11::enum_<SearchStatus>(m, "SearchStatus")
+        .value("NOT_STARTED", SearchStatus::NOT_STARTED)
+        .value("SOLVED", SearchStatus::SOLVED)
+        .value("UNSOLVABLE", SearchStatus::UNSOLVABLE)
+        .value("LIMIT_REACHED", SearchStatus::LIMIT_REACHED)
+        .export_values();
+
+    pybind11::enum_<SearchAlgorithm>(m, "SearchAlgorithm")
+        .value("A_STAR", SearchAlgorithm::A_STAR)
+        .value("IDA_STAR", SearchAlgorithm::IDA_STAR)
+        .export_values();
+
+    pybind11::enum_<MCTSParallelism>(m, "MCTSParallelism")
+        .value("ROOT", MCTSParallelism::ROOT)
+        .value("TREE", MCTSParallelism::TREE)
+        .export_values();
+}
@@ -0,0 +1,139 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Games/BatchGame.hpp>
+#include <baba-is-auto/Games/BatchGame.hpp>
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <stdexcept>
+
+using namespace baba_is_auto;
+
+namespace
+{
+// Copies the observations of all games into a new (N, C, H, W) array, or
+// makes a view of them that lives as long as \p base if it is given.
+pybind11::array_t<float> GetObservations(const BatchGame& batch,
+                                         pybind11::handle base = {})
+{
+    const Map& map = batch.GetGame(0).GetMap();
+    const std::vector<pybind11::ssize_t> shape{
+        static_cast<pybind11::ssize_t>(batch.GetNumGames()),
+        static_cast<pybind11::ssize_t>(batch.GetEncoder().GetNumChannels()),
+        static_cast<pybind11::ssize_t>(map.GetHeight()),
+        static_cast<pybind11::ssize_t>(map.GetWidth())
+    };
+
+    return pybind11::array_t<float>(shape, batch.GetObservations().data(),
+                                    base);
+}
+}  // namespace
+
+void AddBatchGame(pybind11::module& m)
+{
+    pybind11::class_<StepRewards>(m, "StepRewards")
+        .def(pybind11::init<>())
+        .def(pybind11::init([](float win, float lose, float step) {
+                 return StepRewards{ win, lose, step };
+             }),
+             pybind11::arg("win") = 200.0f, pybind11::arg("lose") = -100.0f,
+             pybind11::arg("step") = -0.5f)
+        .def_readwrite("win", &StepRewards::win)
+        .def_readwrite("lose", &StepRewards::lose)
+        .def_readwrite("step", &StepRewards::step);
+
+    pybind11::class_<BatchGame>(m, "BatchGame")
+        .def(pybind11::init([](std::string_view filename,
+                               std::size_t numGames, std::size_t numThreads,
+                               StepRewards rewards, std::size_t maxEpisodeSteps,
+                               std::shared_ptr<ObservationEncoder> encoder) {
+                 return std::make_unique<BatchGame>(filename, numGames,
+                                                    numThreads, rewards,
+                                                    maxEpisodeSteps,
+                                                    std::move(encoder));
+             }),
+             pybind11::arg("filename"), pybind11::arg("numGames"),
+             pybind11::arg("numThreads") = 1,
+             pybind11::arg("rewards") = StepRewards(),
+             pybind11::arg("maxEpisodeSteps") = 0,
+             pybind11::arg("encoder") = nullptr)
+        .def("Reset",
+             [](BatchGame& batch) {
+                 {
+                     pybind11::gil_scoped_release release;
+                     batch.Reset();
+                 }
+                 return GetObservations(batch);
+             })
+        // Takes the Direction value of each game, and returns the tuple of
+        // (observations, rewards, dones) as numpy arrays.
+        .def("Step",
+             [](BatchGame& batch,
+                const pybind11::array_t<std::int64_t,
+                                        pybind11::array::c_style |
+                                            pybind11::array::forcecast>&
+                    actions) {
+                 if (static_cast<std::size_t>(actions.size()) !=
+                     batch.GetNumGames())
+                 {
+                     throw std::invalid_argument(
+                         "BatchGame - The number of actions must match the "
+                         "number of games.");
+                 }
+
+                 std::vector<Direction> directions(batch.GetNumGames());
+                 for (std::size_t i = 0; i < directions.size(); ++i)
+                 {
+                     const std::int64_t action = actions.data()[i];
+                     if (action < 0 ||
+                         action > static_cast<std::int64_t>(Direction::RIGHT))
+                     {
+                         throw std::invalid_argument(
+                             "BatchGame - Invalid action.");
+                     }
+                     directions[i] = static_cast<Direction>(action);
+                 }
+
+                 {
+                     pybind11::gil_scoped_release release;
+                     batch.Step(directions);
+                 }
+
+                 const auto numGames =
+                     static_cast<pybind11::ssize_t>(batch.GetNumGames());
+                 pybind11::array_t<bool> dones(numGames);
+                 for (pybind11::ssize_t i = 0; i < numGames; ++i)
+                 {
+                     dones.mutable_data()[i] = batch.GetDones()[i] != 0;
+                 }
+
+                 return pybind11::make_tuple(
+                     GetObservations(batch),
+                     pybind11::array_t<float>(numGames,
+                                              batch.GetRewards().data()),
+                     dones);
+             })
+        .def("GetNumGames", &BatchGame::GetNumGames)
+        .def("GetObservationSize", &BatchGame::GetObservationSize)
+        .def("GetGame",
+             static_cast<Game& (BatchGame::*)(std::size_t)>(
+                 &BatchGame::GetGame),
+             pybind11::return_value_policy::reference_internal)
+        // A view of the observations without a copy. It changes with each
+        // call of Reset and Step.
+        .def("GetObservations",
+             [](pybind11::object self) {
+                 return GetObservations(self.cast<const BatchGame&>(), self);
+             })
+        .def("GetPlayStates", &BatchGame::GetPlayStates)
+        .def("GetEpisodeSteps", &BatchGame::GetEpisodeSteps);
+
+    // The name used by vectorized environments.
+    m.attr("VectorEnv") = m.attr("BatchGame");
+}
@@ -8,6 +8,7 @@
 #include <baba-is-auto/Games/Game.hpp>
 
 #include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
 
 using namespace baba_is_auto;
 
@@ -15,10 +16,41 @@ void AddGame(pybind11::module& m)
 {
     pybind11::class_<Game>(m, "Game")
         .def(pybind11::init<std::string_view>())
+        .def(pybind11::init<const LevelCorpus&, std::size_t>())
+        // Games made from the same template share its initial state.
+        .def(pybind11::init([](std::shared_ptr<LevelTemplate> level) {
+            return std::make_unique<Game>(
+                std::shared_ptr<const LevelTemplate>(std::move(level)));
+        }))
         .def("Reset", &Game::Reset)
         .def("GetMap", static_cast<Map& (Game::*)()>(&Game::GetMap))
         .def("GetMap", static_cast<const Map& (Game::*)() const>(&Game::GetMap))
-        .def("GetRuleManager", &Game::GetRuleManager)
+        .def("GetRuleManager",
+             static_cast<RuleManager& (Game::*)()>(&Game::GetRuleManager))
+        .def("GetRuleManager",
+             static_cast<const RuleManager& (Game::*)() const>(
+                 &Game::GetRuleManager))
         .def("GetPlayState", &Game::GetPlayState)
-        .def("MovePlayer", &Game::MovePlayer);
+        .def("Hash", &Game::Hash)
+        .def("Snapshot",
+             [](const Game& game) {
+                 const GameSnapshot snapshot = game.Snapshot();
+                 return pybind11::bytes(
+                     reinterpret_cast<const char*>(snapshot.data()),
+                     snapshot.size());
+             })
+        .def("Restore",
+             [](Game& game, const pybind11::bytes& data) {
+                 const std::string bytes = data;
+                 game.Restore(GameSnapshot(bytes.begin(), bytes.end()));
+             })
+        .def("MovePlayer", &Game::MovePlayer)
+        .def("SetRecordEvents", &Game::SetRecordEvents)
+        .def("IsRecordingEvents", &Game::IsRecordingEvents)
+        .def("GetEvents", &Game::GetEvents)
+        .def("SetProfiling", &Game::SetProfiling)
+        .def("IsProfiling", &Game::IsProfiling)
+        .def("GetProfile", &Game::GetProfile,
+             pybind11::return_value_policy::reference_internal)
+        .def("ResetProfile", &Game::ResetProfile);
 }
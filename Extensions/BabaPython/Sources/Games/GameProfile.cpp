@@ -0,0 +1,24 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Games/GameProfile.hpp>
+#include <baba-is-auto/Games/GameProfile.hpp>
+
+#include <pybind11/pybind11.h>
+
+using namespace baba_is_auto;
+
+void AddGameProfile(pybind11::module& m)
+{
+    pybind11::class_<GameProfile>(m, "GameProfile")
+        .def("IsEnabled", &GameProfile::IsEnabled)
+        .def("GetNumCalls", &GameProfile::GetNumCalls)
+        .def("GetTotalNanoseconds", &GameProfile::GetTotalNanoseconds)
+        .def("GetMeanNanoseconds", &GameProfile::GetMeanNanoseconds)
+        .def("GetPercentileNanoseconds",
+             &GameProfile::GetPercentileNanoseconds)
+        .def("GetCount", &GameProfile::GetCount);
+}
@@ -0,0 +1,48 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Games/LevelCorpus.hpp>
+#include <baba-is-auto/Games/LevelCorpus.hpp>
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+using namespace baba_is_auto;
+
+namespace
+{
+pybind11::bytes ToBytes(const ByteBuffer& buffer)
+{
+    return pybind11::bytes(reinterpret_cast<const char*>(buffer.data()),
+                           buffer.size());
+}
+}  // namespace
+
+void AddLevelCorpus(pybind11::module& m)
+{
+    m.def("EncodeLevel",
+          [](const Map& map) { return ToBytes(EncodeLevel(map)); });
+    m.def("EncodeCorpus", [](const std::vector<std::string>& names,
+                             const std::vector<pybind11::bytes>& levels) {
+        std::vector<ByteBuffer> buffers;
+        buffers.reserve(levels.size());
+        for (auto& level : levels)
+        {
+            const std::string bytes = level;
+            buffers.emplace_back(bytes.begin(), bytes.end());
+        }
+
+        return ToBytes(EncodeCorpus(names, buffers));
+    });
+
+    pybind11::class_<LevelCorpus>(m, "LevelCorpus")
+        .def(pybind11::init<std::string_view>())
+        .def("GetNumLevels", &LevelCorpus::GetNumLevels)
+        .def("GetName", &LevelCorpus::GetName)
+        .def("FindLevel", &LevelCorpus::FindLevel)
+        .def("LoadMap", &LevelCorpus::LoadMap)
+        .def("__len__", &LevelCorpus::GetNumLevels);
+}
@@ -0,0 +1,25 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Games/LevelTemplate.hpp>
+#include <baba-is-auto/Games/LevelTemplate.hpp>
+
+#include <pybind11/pybind11.h>
+
+using namespace baba_is_auto;
+
+void AddLevelTemplate(pybind11::module& m)
+{
+    pybind11::class_<LevelTemplate, std::shared_ptr<LevelTemplate>>(
+        m, "LevelTemplate")
+        .def(pybind11::init<std::string_view>())
+        .def(pybind11::init<const LevelCorpus&, std::size_t>())
+        .def(pybind11::init<Map>())
+        .def("GetMap", &LevelTemplate::GetMap,
+             pybind11::return_value_policy::reference_internal)
+        .def("GetRuleManager", &LevelTemplate::GetRuleManager,
+             pybind11::return_value_policy::reference_internal);
+}
@@ -21,13 +21,25 @@ void AddMap(pybind11::module& m)
         .def("GetWidth", &Map::GetWidth)
         .def("GetHeight", &Map::GetHeight)
         .def("Load", &Map::Load)
+        .def("LoadLevel",
+             [](Map& map, const pybind11::bytes& data) {
+                 const std::string bytes = data;
+                 map.LoadLevel(
+                     reinterpret_cast<const std::uint8_t*>(bytes.data()),
+                     bytes.size());
+             })
         .def("AddObject", &Map::AddObject)
-        .def("RemoveObject", &Map::RemoveObject)
-        .def("At",
-             static_cast<Square& (Map::*)(std::size_t, std::size_t)>(&Map::At))
-        .def(
-            "At",
-            static_cast<const Square& (Map::*)(std::size_t, std::size_t) const>(
-                &Map::At));
+        .def("RemoveObject",
+             static_cast<void (Map::*)(std::size_t, std::size_t,
+                                       const Object&)>(&Map::RemoveObject))
+        .def("At", &Map::At)
+        .def("GetObjects", &Map::GetObjects)
+        .def("IsRule", &Map::IsRule)
+        .def("HasTextType", &Map::HasTextType)
+        .def("GetNumObjects", &Map::GetNumObjects)
+        .def("GetNumObjectIds", &Map::GetNumObjectIds)
+        .def("GetHash", &Map::GetHash)
+        .def("GetDirtyCells", &Map::GetDirtyCells)
+        .def("AreAllCellsDirty", &Map::AreAllCellsDirty);
         // .def("GetPositions", &Map::GetPositions);
 }
@@ -30,9 +30,10 @@ void AddObject(pybind11::module& m)
         .def(pybind11::init<>())
         .def(pybind11::init<std::size_t, std::size_t, ObjectContainer>())
         .def("GetObjects", 
-	     [](const Square sq){
+	     [](const Square& sq){
 		 return sq.GetObjects();
 	     })
+        .def_readonly("isRule", &Square::isRule)
         .def("HasTextType", &Square::HasTextType)
         .def("HasNounType", &Square::HasNounType)
         .def("HasVerbType", &Square::HasVerbType)
@@ -0,0 +1,30 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Games/StepEvent.hpp>
+#include <baba-is-auto/Games/StepEvent.hpp>
+
+#include <pybind11/pybind11.h>
+
+using namespace baba_is_auto;
+
+void AddStepEvent(pybind11::module& m)
+{
+    pybind11::class_<StepEvent>(m, "StepEvent")
+        .def(pybind11::init<>())
+        .def_readonly("type", &StepEvent::type)
+        .def_readonly("id", &StepEvent::id)
+        .def_readonly("objectType", &StepEvent::objectType)
+        .def_readonly("newType", &StepEvent::newType)
+        .def_readonly("x", &StepEvent::x)
+        .def_readonly("y", &StepEvent::y)
+        .def_readonly("toX", &StepEvent::toX)
+        .def_readonly("toY", &StepEvent::toY)
+        .def_readonly("subject", &StepEvent::subject)
+        .def_readonly("op", &StepEvent::op)
+        .def_readonly("predicate", &StepEvent::predicate)
+        .def_readonly("playState", &StepEvent::playState);
+}
@@ -22,5 +22,13 @@ void AddRuleManager(pybind11::module& m)
         .def("GetRules", &RuleManager::GetRules)
         .def("GetAllRules", &RuleManager::GetAllRules)
         .def("GetNumRules", &RuleManager::GetNumRules)
-        .def("HasType", &RuleManager::HasType);
+        .def("HasType",
+             static_cast<bool (RuleManager::*)(const Object&, const Map&,
+                                               ObjectType) const>(
+                 &RuleManager::HasType))
+        .def("HasType",
+             static_cast<bool (RuleManager::*)(ObjectType, ObjectType) const>(
+                 &RuleManager::HasType))
+        .def("GetProperties", &RuleManager::GetProperties)
+        .def("GetPropertyTable", &RuleManager::GetPropertyTable);
 }
@@ -4,14 +4,29 @@
 // personal capacity and am not conveying any rights to any intellectual
 // property of any third parties.
 
+#include <Agents/BFSSolverAgent.hpp>
+#include <Agents/HeuristicSearchAgent.hpp>
+#include <Agents/Heuristics.hpp>
 #include <Agents/IAgent.hpp>
+#include <Agents/MCTSAgent.hpp>
+#include <Agents/ObservationBuffer.hpp>
+#include <Agents/ObservationEncoder.hpp>
+#include <Agents/ParallelBFSSolverAgent.hpp>
 #include <Agents/Preprocess.hpp>
 #include <Agents/RandomAgent.hpp>
+#include <Agents/RolloutEngine.hpp>
+#include <Agents/SolverAgent.hpp>
 #include <Enums/GameEnums.hpp>
 #include <Enums/RuleEnums.hpp>
+#include <Enums/SearchEnums.hpp>
+#include <Games/BatchGame.hpp>
 #include <Games/Game.hpp>
+#include <Games/GameProfile.hpp>
+#include <Games/LevelCorpus.hpp>
+#include <Games/LevelTemplate.hpp>
 #include <Games/Map.hpp>
 #include <Games/Object.hpp>
+#include <Games/StepEvent.hpp>
 #include <Rules/Rule.hpp>
 #include <Rules/RuleManager.hpp>
 
@@ -22,17 +37,33 @@ PYBIND11_MODULE(pyBaba, m)
     m.doc() =
         R"pbdoc(Baba Is You simulator with some reinforcement learning)pbdoc";
 
-    AddIAgent(m);
-    AddPreprocess(m);
-    AddRandomAgent(m);
-
+    // Enums go first, since agents use them as default arguments.
     AddGameEnums(m);
     AddGameEnumUtils(m);
     AddRuleEnums(m);
+    AddSearchEnums(m);
+
+    AddIAgent(m);
+    AddPreprocess(m);
+    AddObservationEncoder(m);
+    AddObservationBuffer(m);
+    AddRandomAgent(m);
+    AddSolverAgent(m);
+    AddBFSSolverAgent(m);
+    AddHeuristics(m);
+    AddHeuristicSearchAgent(m);
+    AddParallelBFSSolverAgent(m);
+    AddMCTSAgent(m);
+    AddRolloutEngine(m);
 
     AddGame(m);
+    AddGameProfile(m);
+    AddBatchGame(m);
     AddMap(m);
+    AddLevelCorpus(m);
+    AddLevelTemplate(m);
     AddObject(m);
+    AddStepEvent(m);
 
     AddRule(m);
     AddRuleManager(m);
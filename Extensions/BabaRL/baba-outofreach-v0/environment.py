@@ -1,7 +1,6 @@
 import gym
 from gym.utils import seeding
 from gym.envs.registration import register
-import numpy as np
 
 import pyBaba
 import rendering
@@ -63,9 +62,7 @@ class BabaEnv(gym.Env):
         return self.renderer.render(self.game.GetMap(), mode)
 
     def get_obs(self):
-        return np.array(
-            pyBaba.Preprocess.StateToTensor(self.game),
-            dtype=np.float32).reshape(-1, self.game.GetMap().GetHeight(), self.game.GetMap().GetWidth())
+        return pyBaba.Preprocess.StateToArray(self.game)
 
 
 register(
@@ -0,0 +1,41 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef BABA_IS_AUTO_BFS_SOLVER_AGENT_HPP
+#define BABA_IS_AUTO_BFS_SOLVER_AGENT_HPP
+
+#include <baba-is-auto/Agents/SolverAgent.hpp>
+
+namespace baba_is_auto
+{
+//!
+//! \brief BFSSolverAgent class.
+//!
+//! This class searches the game breadth-first, so the sequence of actions it
+//! finds is a shortest one. States are told apart by Game::Hash, and a state
+//! that was seen before is not expanded again. Only the states on the
+//! frontier are kept as snapshots; the others are kept as links to their
+//! parents.
+//!
+class BFSSolverAgent final : public SolverAgent
+{
+ public:
+    //! Constructs BFS solver agent with given \p limits.
+    //! \param limits The bounds of each search.
+    explicit BFSSolverAgent(SearchLimits limits = SearchLimits());
+
+ protected:
+    //! Searches a shortest sequence of actions that wins \p game.
+    //! \param game The game to solve.
+    //! \param solution The sequence of actions to fill when it is solved.
+    //! \param stats The statistics to update while searching.
+    //! \return The result of the search.
+    SearchStatus Search(const Game& game, std::vector<Direction>& solution,
+                        SearchStats& stats) override;
+};
+}  // namespace baba_is_auto
+
+#endif  // BABA_IS_AUTO_BFS_SOLVER_AGENT_HPP
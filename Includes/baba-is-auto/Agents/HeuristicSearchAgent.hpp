@@ -0,0 +1,84 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef BABA_IS_AUTO_HEURISTIC_SEARCH_AGENT_HPP
+#define BABA_IS_AUTO_HEURISTIC_SEARCH_AGENT_HPP
+
+#include <baba-is-auto/Agents/Heuristics.hpp>
+#include <baba-is-auto/Agents/SolverAgent.hpp>
+
+#include <memory>
+#include <unordered_set>
+
+namespace baba_is_auto
+{
+//!
+//! \brief HeuristicSearchAgent class.
+//!
+//! This class searches the game guided by a heuristic, either with A* or
+//! with IDA*. A* keeps every state it has seen, like BFSSolverAgent, and
+//! expands the most promising one first. IDA* runs depth-first searches
+//! with a growing bound on the estimated length, keeping only the states on
+//! the current path, so its memory is bounded by the solution length. Both
+//! find shortest solutions when the heuristic is admissible, as the default
+//! one is.
+//!
+class HeuristicSearchAgent final : public SolverAgent
+{
+ public:
+    //! Constructs heuristic search agent with given \p algorithm,
+    //! \p heuristic and \p limits.
+    //! \param algorithm The algorithm to search with.
+    //! \param heuristic The heuristic to guide the search, or nullptr for
+    //! the default one.
+    //! \param limits The bounds of each search.
+    explicit HeuristicSearchAgent(
+        SearchAlgorithm algorithm = SearchAlgorithm::A_STAR,
+        std::shared_ptr<const IHeuristic> heuristic = MakeDefaultHeuristic(),
+        SearchLimits limits = SearchLimits());
+
+    //! Gets the algorithm to search with.
+    //! \return The algorithm to search with.
+    SearchAlgorithm GetAlgorithm() const;
+
+ protected:
+    //! Searches a sequence of actions that wins \p game.
+    //! \param game The game to solve.
+    //! \param solution The sequence of actions to fill when it is solved.
+    //! \param stats The statistics to update while searching.
+    //! \return The result of the search.
+    SearchStatus Search(const Game& game, std::vector<Direction>& solution,
+                        SearchStats& stats) override;
+
+ private:
+    SearchStatus SearchAStar(const Game& game, std::vector<Direction>& solution,
+                             SearchStats& stats);
+    SearchStatus SearchIDAStar(const Game& game,
+                               std::vector<Direction>& solution,
+                               SearchStats& stats);
+
+    //! The state of a depth-first search of IDA*.
+    struct DepthFirstContext
+    {
+        Game work;
+        std::vector<GameSnapshot> snapshots;
+        std::vector<Direction> path;
+        std::unordered_set<std::uint64_t> onPath;
+        SearchStats& stats;
+        int bound;
+        bool isLimitReached;
+    };
+
+    //! Searches below the last state of the path of \p context.
+    //! \return -1 if it wins, otherwise the least estimate over the bound.
+    int SearchDepthFirst(DepthFirstContext& context, int cost);
+
+    SearchAlgorithm m_algorithm;
+    std::shared_ptr<const IHeuristic> m_heuristic;
+};
+}  // namespace baba_is_auto
+
+#endif  // BABA_IS_AUTO_HEURISTIC_SEARCH_AGENT_HPP
@@ -0,0 +1,112 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef BABA_IS_AUTO_HEURISTICS_HPP
+#define BABA_IS_AUTO_HEURISTICS_HPP
+
+#include <baba-is-auto/Games/Game.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace baba_is_auto
+{
+//!
+//! \brief IHeuristic class.
+//!
+//! This class is an interface of the estimates of the number of actions
+//! needed to win a game. An estimate that never exceeds the true number is
+//! admissible, and A* and IDA* find shortest solutions only with those.
+//!
+class IHeuristic
+{
+ public:
+    //! Default virtual destructor.
+    virtual ~IHeuristic() = default;
+
+    //! Estimates the number of actions needed to win \p game.
+    //! \param game The game to estimate.
+    //! \return The estimated number of actions.
+    virtual int Estimate(const Game& game) const = 0;
+};
+
+//!
+//! \brief ZeroHeuristic class.
+//!
+//! This class always estimates zero, which turns A* into uniform-cost search.
+//!
+class ZeroHeuristic final : public IHeuristic
+{
+ public:
+    int Estimate(const Game& game) const override;
+};
+
+//!
+//! \brief YouToWinDistanceHeuristic class.
+//!
+//! This class estimates the Manhattan distance between the nearest pair of a
+//! YOU object and a WIN object, or zero if there is no such pair. It is not
+//! admissible: a moving WIN object or a rule that makes YOU itself WIN wins
+//! in fewer actions. It guides a search to a solution quickly, but not to a
+//! shortest one.
+//!
+class YouToWinDistanceHeuristic final : public IHeuristic
+{
+ public:
+    int Estimate(const Game& game) const override;
+};
+
+//!
+//! \brief RuleTextDistanceHeuristic class.
+//!
+//! This class estimates how far the texts of YOU and WIN are from forming a
+//! rule when no "X IS YOU" or "X IS WIN" rule exists: the Manhattan distance
+//! from the nearest property text to a square right of (or below) an IS
+//! text that follows a noun. It is zero when the rules exist or no such
+//! square exists. It is not admissible, since the noun and IS texts can move
+//! toward the property text as well. It guides a search to a solution
+//! quickly, but not to a shortest one.
+//!
+class RuleTextDistanceHeuristic final : public IHeuristic
+{
+ public:
+    int Estimate(const Game& game) const override;
+};
+
+//!
+//! \brief MaxHeuristic class.
+//!
+//! This class estimates the maximum of other heuristics. It is admissible if
+//! all of them are.
+//!
+class MaxHeuristic final : public IHeuristic
+{
+ public:
+    //! Constructs max heuristic with given \p heuristics.
+    //! \param heuristics The heuristics to take the maximum of.
+    explicit MaxHeuristic(
+        std::vector<std::shared_ptr<const IHeuristic>> heuristics);
+
+    int Estimate(const Game& game) const override;
+
+ private:
+    std::vector<std::shared_ptr<const IHeuristic>> m_heuristics;
+};
+
+//! Makes the heuristic that the search agents use by default. It is
+//! ZeroHeuristic, because any rule can change in one action and no other
+//! estimate is admissible in every game.
+//! \return The default heuristic.
+std::shared_ptr<const IHeuristic> MakeDefaultHeuristic();
+
+//! Makes the maximum of YouToWinDistanceHeuristic and
+//! RuleTextDistanceHeuristic. It is not admissible, so the search agents
+//! find solutions with it faster, but not always shortest ones.
+//! \return The guided heuristic.
+std::shared_ptr<const IHeuristic> MakeGuidedHeuristic();
+}  // namespace baba_is_auto
+
+#endif  // BABA_IS_AUTO_HEURISTICS_HPP
@@ -0,0 +1,182 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef BABA_IS_AUTO_MCTS_AGENT_HPP
+#define BABA_IS_AUTO_MCTS_AGENT_HPP
+
+#include <baba-is-auto/Agents/Heuristics.hpp>
+#include <baba-is-auto/Agents/IAgent.hpp>
+#include <baba-is-auto/Agents/SolverAgent.hpp>
+#include <baba-is-auto/Enums/SearchEnums.hpp>
+#include <baba-is-auto/Utils/ThreadPool.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace baba_is_auto
+{
+//! \brief The options of MCTSAgent.
+struct MCTSOptions
+{
+    //! The number of iterations of each search, shared by all threads.
+    //! Zero means unbounded.
+    std::size_t maxIterations = 1000;
+
+    //! The wall-clock time of each search, in seconds. Zero means unbounded.
+    //! At least one of maxIterations and maxSeconds must be non-zero.
+    double maxSeconds = 0.0;
+
+    //! The number of random actions of a rollout.
+    std::size_t rolloutDepth = 50;
+
+    //! The exploration constant of UCT.
+    double explorationConstant = 1.41421356;
+
+    //! The number of threads. Zero means the number of hardware threads.
+    std::size_t numThreads = 1;
+
+    //! How the threads share the search.
+    MCTSParallelism parallelism = MCTSParallelism::TREE;
+
+    //! The number of losses a thread adds to the nodes on its path until it
+    //! backs up its result, so that other threads take other paths. It is
+    //! used only by tree parallelism.
+    int virtualLoss = 1;
+
+    //! The seed of the random actions. Thread i uses a stream seeded by
+    //! seed + i, and the stream goes on between searches.
+    std::uint64_t seed = 0;
+};
+
+//! \brief The statistics of the last search of MCTSAgent.
+struct MCTSStats
+{
+    //! The number of iterations of all threads.
+    std::size_t iterations = 0;
+
+    //! The number of rollouts, which are iterations that did not end on a
+    //! node whose game is over.
+    std::size_t rollouts = 0;
+
+    //! The number of actions played by rollouts.
+    std::size_t rolloutSteps = 0;
+
+    //! The number of nodes in the tree, or in all trees.
+    std::size_t treeNodes = 0;
+
+    //! The number of threads that searched.
+    std::size_t numThreads = 0;
+
+    //! The wall-clock time of the search, in seconds.
+    double elapsedSeconds = 0.0;
+
+    //! Gets the number of rollouts per second.
+    //! \return The number of rollouts per second.
+    double GetRolloutsPerSecond() const
+    {
+        return elapsedSeconds > 0.0
+                   ? static_cast<double>(rollouts) / elapsedSeconds
+                   : 0.0;
+    }
+
+    //! Gets the number of rollouts per second of each thread.
+    //! \return The number of rollouts per second of each thread.
+    double GetRolloutsPerSecondPerThread() const
+    {
+        return numThreads > 0
+                   ? GetRolloutsPerSecond() / static_cast<double>(numThreads)
+                   : 0.0;
+    }
+};
+
+//!
+//! \brief MCTSAgent class.
+//!
+//! This class chooses actions by Monte Carlo tree search with UCT. Each
+//! iteration restores a copy of the game to the root, plays the actions of
+//! the tree down to a leaf, adds one child and plays random actions from it.
+//! A win is worth 1, a loss 0, and a rollout that runs out of actions is
+//! worth 0.5 / (1 + h) where h is the estimate of the heuristic, or 0 if
+//! there is none.
+//!
+//! With more than one thread, either each thread grows its own tree and the
+//! visits of the roots are summed (root parallelism), or all threads grow one
+//! tree whose nodes are updated by atomic operations and reserved by virtual
+//! loss (tree parallelism).
+//!
+class MCTSAgent final : public IAgent
+{
+ public:
+    //! Constructs MCTS agent with given \p options and \p heuristic.
+    //! \param options The options of each search.
+    //! \param heuristic The heuristic that values unfinished rollouts, or
+    //! nullptr to value them 0.
+    explicit MCTSAgent(MCTSOptions options = MCTSOptions(),
+                       std::shared_ptr<const IHeuristic> heuristic = nullptr);
+
+    //! Destructor.
+    ~MCTSAgent();
+
+    //! Searches \p game and chooses the action visited the most at the root.
+    //! \param game The game to search. It is not modified.
+    //! \return The chosen action, or Direction::NONE if the game is over.
+    Direction Search(const Game& game);
+
+    //! Gets an action of agent.
+    //! \param state The current game state.
+    //! \return An action of agent.
+    Direction GetAction(const Game& state) override;
+
+    //! Gets the number of visits of each action of SEARCH_ACTIONS at the
+    //! root of the last search.
+    //! \return The number of visits of each action.
+    const std::array<std::size_t, SEARCH_ACTIONS.size()>& GetRootVisits()
+        const;
+
+    //! Gets the mean value of each action of SEARCH_ACTIONS at the root of
+    //! the last search, or 0 for an action that was not visited.
+    //! \return The mean value of each action.
+    const std::array<double, SEARCH_ACTIONS.size()>& GetRootValues() const;
+
+    //! Gets the statistics of the last search.
+    //! \return The statistics of the last search.
+    const MCTSStats& GetStats() const;
+
+    //! Gets the options of each search.
+    //! \return The options of each search.
+    const MCTSOptions& GetOptions() const;
+
+ private:
+    struct Node;
+    struct ThreadContext;
+
+    void RunIterations(Node& root, const GameSnapshot& rootSnapshot,
+                       ThreadContext& context, int virtualLoss);
+    Node* SelectChild(Node& node) const;
+    Node* ExpandChild(Node& node, Game& work, int virtualLoss,
+                      ThreadContext& context) const;
+    double Rollout(Game& work, ThreadContext& context) const;
+
+    MCTSOptions m_options;
+    std::shared_ptr<const IHeuristic> m_heuristic;
+
+    ThreadPool m_pool;
+    std::vector<ThreadContext> m_contexts;
+
+    std::atomic<std::size_t> m_numStarted{ 0 };
+    std::chrono::steady_clock::time_point m_startTime;
+
+    std::array<std::size_t, SEARCH_ACTIONS.size()> m_rootVisits{};
+    std::array<double, SEARCH_ACTIONS.size()> m_rootValues{};
+    MCTSStats m_stats;
+};
+}  // namespace baba_is_auto
+
+#endif  // BABA_IS_AUTO_MCTS_AGENT_HPP
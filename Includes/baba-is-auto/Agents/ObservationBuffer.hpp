@@ -0,0 +1,93 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef BABA_IS_AUTO_OBSERVATION_BUFFER_HPP
+#define BABA_IS_AUTO_OBSERVATION_BUFFER_HPP
+
+#include <baba-is-auto/Agents/ObservationEncoder.hpp>
+#include <baba-is-auto/Games/Game.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace baba_is_auto
+{
+//!
+//! \brief ObservationBuffer class.
+//!
+//! This class owns the tensor of a game state laid out as (channels, height,
+//! width) floats by an ObservationEncoder, and rewrites it in place from a
+//! game, so that an observation can be taken each step without allocating.
+//!
+class ObservationBuffer
+{
+ public:
+    //! Constructs observation buffer for the map of \p game.
+    //! \param game The game whose state is observed.
+    //! \param encoder The encoder of the tensor, or nullptr for the layout of
+    //! Preprocess.
+    explicit ObservationBuffer(
+        const Game& game,
+        std::shared_ptr<const ObservationEncoder> encoder = nullptr);
+
+    //! Constructs observation buffer with given \p width and \p height.
+    //! \param width The width of the map.
+    //! \param height The height of the map.
+    //! \param encoder The encoder of the tensor, or nullptr for the layout of
+    //! Preprocess.
+    ObservationBuffer(
+        std::size_t width, std::size_t height,
+        std::shared_ptr<const ObservationEncoder> encoder = nullptr);
+
+    //! Rewrites the tensor from the state of \p game.
+    //! \param game The game whose map has the size of the buffer.
+    void Update(const Game& game);
+
+    //! Rewrites the tensor only on the squares that the last MovePlayer of
+    //! \p game has changed. The tensor must hold the state of \p game before
+    //! that step, so it is kept in step with one game.
+    //! \param game The game whose map has the size of the buffer.
+    void UpdateChanges(const Game& game);
+
+    //! Gets the encoder of the tensor.
+    //! \return The encoder of the tensor.
+    const ObservationEncoder& GetEncoder() const;
+
+    //! Gets the number of channels.
+    //! \return The number of channels.
+    std::size_t GetNumChannels() const;
+
+    //! Gets the height of the map.
+    //! \return The height of the map.
+    std::size_t GetHeight() const;
+
+    //! Gets the width of the map.
+    //! \return The width of the map.
+    std::size_t GetWidth() const;
+
+    //! Gets the number of floats of the tensor.
+    //! \return The number of floats of the tensor.
+    std::size_t GetSize() const;
+
+    //! Gets the floats of the tensor.
+    //! \return The floats of the tensor.
+    float* GetData();
+
+    //! Gets the floats of the tensor.
+    //! \return The floats of the tensor.
+    const float* GetData() const;
+
+ private:
+    void CheckSize(const Game& game) const;
+
+    std::shared_ptr<const ObservationEncoder> m_encoder;
+    std::size_t m_width;
+    std::size_t m_height;
+    std::vector<float> m_data;
+};
+}  // namespace baba_is_auto
+
+#endif  // BABA_IS_AUTO_OBSERVATION_BUFFER_HPP
@@ -0,0 +1,128 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef BABA_IS_AUTO_OBSERVATION_ENCODER_HPP
+#define BABA_IS_AUTO_OBSERVATION_ENCODER_HPP
+
+#include <baba-is-auto/Games/Game.hpp>
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace baba_is_auto
+{
+//!
+//! \brief The layout of the channels of an observation.
+//!
+//! Channel i is set on the squares that have an object of any type of
+//! typeChannels[i]. The derived planes follow the type channels in the order
+//! of the members below.
+//!
+struct EncoderSpec
+{
+    //! The object types of each type channel. A type may appear only once,
+    //! and types that do not appear are not encoded.
+    std::vector<TypeSequence> typeChannels;
+
+    //! Adds a plane set on the squares that have a text object.
+    bool hasTextPlane = false;
+
+    //! Adds a plane set on the squares that are a part of a rule.
+    bool hasRulePlane = false;
+
+    //! Adds a plane for each property, set on the squares that have an
+    //! object with the property under the current rules.
+    TypeSequence propertyPlanes;
+};
+
+//!
+//! \brief ObservationEncoder class.
+//!
+//! This class encodes a game state into a tensor of (channels, height, width)
+//! floats as laid out by an EncoderSpec. The spec is compiled into a table
+//! from each object type to its channel, so encoding an object is an array
+//! lookup.
+//!
+class ObservationEncoder
+{
+ public:
+    //! Constructs observation encoder with given \p spec.
+    //! \param spec The layout of the channels.
+    explicit ObservationEncoder(EncoderSpec spec);
+
+    //! Makes the 16-channel layout of Preprocess: 14 object types of
+    //! baba_is_you.txt, the text plane and the rule plane.
+    //! \return The layout of Preprocess.
+    static EncoderSpec MakeDefaultSpec();
+
+    //! Makes the layout with a channel for each object type of the
+    //! vocabulary, the text plane, the rule plane and, if asked, a plane for
+    //! each property.
+    //! \param hasPropertyPlanes The flag to add a plane for each property.
+    //! \return The layout of the whole vocabulary.
+    static EncoderSpec MakeFullSpec(bool hasPropertyPlanes = true);
+
+    //! Gets the encoder of the layout of Preprocess.
+    //! \return The encoder of the layout of Preprocess.
+    static const ObservationEncoder& GetDefault();
+
+    //! Gets the layout of the channels.
+    //! \return The layout of the channels.
+    const EncoderSpec& GetSpec() const;
+
+    //! Gets the number of channels.
+    //! \return The number of channels.
+    std::size_t GetNumChannels() const;
+
+    //! Gets the channel of the objects of \p type.
+    //! \param type The object type.
+    //! \return The channel of \p type, or -1 if it is not encoded.
+    int GetChannel(ObjectType type) const;
+
+    //! Gets the number of floats of the tensor of \p game.
+    //! \param game The game state.
+    //! \return The number of floats of the tensor.
+    std::size_t GetTensorSize(const Game& game) const;
+
+    //! Encodes \p game into a new tensor.
+    //! \param game The game state.
+    //! \return The encoded tensor.
+    std::vector<float> Encode(const Game& game) const;
+
+    //! Encodes \p game into \p tensor.
+    //! \param game The game state.
+    //! \param tensor The buffer of GetTensorSize(game) floats to write to.
+    void Encode(const Game& game, float* tensor) const;
+
+    //! Patches \p tensor, which holds the encoding of \p game before its
+    //! last MovePlayer, on the dirty squares of the map only. It encodes the
+    //! whole tensor when all squares are dirty, or when property planes are
+    //! encoded and the step has changed the rules of properties.
+    //! \param game The game to encode.
+    //! \param tensor The tensor of GetTensorSize(game) floats to patch.
+    void EncodeChanges(const Game& game, float* tensor) const;
+
+ private:
+    void EncodeCell(const Game& game, std::size_t x, std::size_t y,
+                    float* tensor) const;
+
+    static constexpr std::int16_t NO_CHANNEL = -1;
+
+    EncoderSpec m_spec;
+    std::size_t m_numChannels = 0;
+
+    std::array<std::int16_t, 256> m_typeChannels{};
+    int m_textChannel = NO_CHANNEL;
+    int m_ruleChannel = NO_CHANNEL;
+
+    // The properties that have a plane, and the plane of each property bit.
+    PropertyMask m_propertyMask = 0;
+    std::array<std::int16_t, 64> m_propertyChannels{};
+};
+}  // namespace baba_is_auto
+
+#endif  // BABA_IS_AUTO_OBSERVATION_ENCODER_HPP
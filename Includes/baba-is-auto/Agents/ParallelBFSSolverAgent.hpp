@@ -0,0 +1,55 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef BABA_IS_AUTO_PARALLEL_BFS_SOLVER_AGENT_HPP
+#define BABA_IS_AUTO_PARALLEL_BFS_SOLVER_AGENT_HPP
+
+#include <baba-is-auto/Agents/SolverAgent.hpp>
+#include <baba-is-auto/Utils/ThreadPool.hpp>
+
+namespace baba_is_auto
+{
+//!
+//! \brief ParallelBFSSolverAgent class.
+//!
+//! This class searches the game breadth-first on many threads, one depth at
+//! a time. The states of a depth are shared out to the threads in chunks,
+//! each thread expands them on its own copy of the game into its own buffer,
+//! and the buffers are joined into the next depth when all threads are done.
+//! Seen states are kept in a ConcurrentHashSet that the threads insert into
+//! without locks, so the sequence of actions it finds is a shortest one, like
+//! BFSSolverAgent, though which one may differ from run to run.
+//!
+class ParallelBFSSolverAgent final : public SolverAgent
+{
+ public:
+    //! Constructs parallel BFS solver agent with given \p numThreads and
+    //! \p limits.
+    //! \param numThreads The number of threads. Zero means the number of
+    //! hardware threads.
+    //! \param limits The bounds of each search.
+    explicit ParallelBFSSolverAgent(std::size_t numThreads = 0,
+                                    SearchLimits limits = SearchLimits());
+
+    //! Gets the number of threads.
+    //! \return The number of threads.
+    std::size_t GetNumThreads() const;
+
+ protected:
+    //! Searches a shortest sequence of actions that wins \p game.
+    //! \param game The game to solve.
+    //! \param solution The sequence of actions to fill when it is solved.
+    //! \param stats The statistics to update while searching.
+    //! \return The result of the search.
+    SearchStatus Search(const Game& game, std::vector<Direction>& solution,
+                        SearchStats& stats) override;
+
+ private:
+    ThreadPool m_pool;
+};
+}  // namespace baba_is_auto
+
+#endif  // BABA_IS_AUTO_PARALLEL_BFS_SOLVER_AGENT_HPP
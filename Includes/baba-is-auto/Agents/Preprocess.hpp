@@ -16,7 +16,9 @@ namespace baba_is_auto
 //!
 //! \brief Preprocess class.
 //!
-//! This class contains utility functions for preprocess.
+//! This class contains utility functions for preprocess. The tensor is laid
+//! out by ObservationEncoder::MakeDefaultSpec; use ObservationEncoder for
+//! other layouts.
 //!
 class Preprocess
 {
@@ -28,6 +30,16 @@ class Preprocess
     //! \param game The game state.
     //! \return The converted tensor.
     static std::vector<float> StateToTensor(const Game& game);
+
+    //! Converts the game state to the tensor in place.
+    //! \param game The game state.
+    //! \param tensor The buffer of GetTensorSize(game) floats to write to.
+    static void StateToTensor(const Game& game, float* tensor);
+
+    //! Gets the number of floats of the tensor of the game state.
+    //! \param game The game state.
+    //! \return The number of floats of the tensor.
+    static std::size_t GetTensorSize(const Game& game);
 };
 }  // namespace baba_is_auto
 
@@ -14,7 +14,8 @@ namespace baba_is_auto
 //!
 //! \brief RandomAgent class.
 //!
-//! This class is an agent that plays an action at random.
+//! This class is an agent that plays an action at random. Each thread draws
+//! from its own random engine, so agents can play on several threads.
 //!
 class RandomAgent final : public IAgent
 {
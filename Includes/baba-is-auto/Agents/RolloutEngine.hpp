@@ -0,0 +1,173 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef BABA_IS_AUTO_ROLLOUT_ENGINE_HPP
+#define BABA_IS_AUTO_ROLLOUT_ENGINE_HPP
+
+#include <baba-is-auto/Agents/IAgent.hpp>
+#include <baba-is-auto/Utils/ThreadPool.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace baba_is_auto
+{
+//! \brief The options of RolloutEngine.
+struct RolloutOptions
+{
+    //! The number of playouts of each run.
+    std::size_t numPlayouts = 1000;
+
+    //! The number of actions after which a playout stops unfinished.
+    std::size_t maxDepth = 50;
+
+    //! The number of threads. Zero means the number of hardware threads.
+    std::size_t numThreads = 1;
+
+    //! The seed of the random actions. Thread i uses a stream seeded by
+    //! seed + i, and the stream goes on between runs.
+    std::uint64_t seed = 0;
+};
+
+//! \brief The statistics of a run of RolloutEngine.
+struct RolloutStats
+{
+    //! The number of playouts.
+    std::size_t numPlayouts = 0;
+
+    //! The number of playouts that won.
+    std::size_t numWins = 0;
+
+    //! The number of playouts that lost.
+    std::size_t numLosses = 0;
+
+    //! The number of playouts that reached maxDepth still playing.
+    std::size_t numUnfinished = 0;
+
+    //! The number of actions played by all playouts.
+    std::size_t totalSteps = 0;
+
+    //! The number of actions played by the playouts that won.
+    std::size_t totalWinSteps = 0;
+
+    //! The number of actions of the shortest win, or 0 without wins.
+    std::size_t minWinSteps = 0;
+
+    //! The number of actions of the longest playout.
+    std::size_t maxSteps = 0;
+
+    //! The number of threads that played.
+    std::size_t numThreads = 0;
+
+    //! The wall-clock time of the run, in seconds.
+    double elapsedSeconds = 0.0;
+
+    //! Gets the fraction of the playouts that won.
+    //! \return The fraction of the playouts that won.
+    double GetWinRate() const
+    {
+        return numPlayouts > 0 ? static_cast<double>(numWins) /
+                                     static_cast<double>(numPlayouts)
+                               : 0.0;
+    }
+
+    //! Gets the fraction of the playouts that lost.
+    //! \return The fraction of the playouts that lost.
+    double GetLossRate() const
+    {
+        return numPlayouts > 0 ? static_cast<double>(numLosses) /
+                                     static_cast<double>(numPlayouts)
+                               : 0.0;
+    }
+
+    //! Gets the mean number of actions of a playout.
+    //! \return The mean number of actions of a playout.
+    double GetMeanSteps() const
+    {
+        return numPlayouts > 0 ? static_cast<double>(totalSteps) /
+                                     static_cast<double>(numPlayouts)
+                               : 0.0;
+    }
+
+    //! Gets the mean number of actions of a playout that won.
+    //! \return The mean number of actions of a win, or 0 without wins.
+    double GetMeanWinSteps() const
+    {
+        return numWins > 0 ? static_cast<double>(totalWinSteps) /
+                                 static_cast<double>(numWins)
+                           : 0.0;
+    }
+
+    //! Gets the number of actions played per second.
+    //! \return The number of actions played per second.
+    double GetStepsPerSecond() const
+    {
+        return elapsedSeconds > 0.0
+                   ? static_cast<double>(totalSteps) / elapsedSeconds
+                   : 0.0;
+    }
+};
+
+//!
+//! \brief RolloutEngine class.
+//!
+//! This class plays many independent playouts from a state of a game on a
+//! pool of threads and counts how they end. Each thread keeps a copy of the
+//! game that is restored from a snapshot of the state before each playout,
+//! and its own random stream, so threads share nothing while they play.
+//! Thread i plays the playouts i, i + n, i + 2n, ... of n threads, so a run
+//! with the same options gives the same statistics.
+//!
+//! A playout plays random actions of SEARCH_ACTIONS, or the actions of an
+//! agent if an agent factory is given. The factory makes one agent for each
+//! thread, since agents keep state between calls.
+//!
+class RolloutEngine
+{
+ public:
+    //! The function that makes the agent of a thread.
+    using AgentFactory = std::function<std::shared_ptr<IAgent>()>;
+
+    //! Constructs rollout engine with given \p options and \p agentFactory.
+    //! \param options The options of each run.
+    //! \param agentFactory The function that makes the agent of each thread,
+    //! or nullptr to play random actions.
+    explicit RolloutEngine(RolloutOptions options = RolloutOptions(),
+                           const AgentFactory& agentFactory = nullptr);
+
+    //! Destructor.
+    ~RolloutEngine();
+
+    //! Deleted copy constructor.
+    RolloutEngine(const RolloutEngine&) = delete;
+
+    //! Deleted copy assignment operator.
+    RolloutEngine& operator=(const RolloutEngine&) = delete;
+
+    //! Plays options.numPlayouts playouts from the state of \p game.
+    //! \param game The game to play from. It is not modified.
+    //! \return The statistics of the playouts.
+    RolloutStats Run(const Game& game);
+
+    //! Gets the options of each run.
+    //! \return The options of each run.
+    const RolloutOptions& GetOptions() const;
+
+ private:
+    struct ThreadContext;
+
+    void RunPlayouts(const GameSnapshot& snapshot, std::size_t threadIdx);
+
+    RolloutOptions m_options;
+
+    ThreadPool m_pool;
+    std::vector<ThreadContext> m_contexts;
+};
+}  // namespace baba_is_auto
+
+#endif  // BABA_IS_AUTO_ROLLOUT_ENGINE_HPP
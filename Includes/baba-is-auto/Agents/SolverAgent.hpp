@@ -0,0 +1,139 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef BABA_IS_AUTO_SOLVER_AGENT_HPP
+#define BABA_IS_AUTO_SOLVER_AGENT_HPP
+
+#include <baba-is-auto/Agents/IAgent.hpp>
+#include <baba-is-auto/Enums/SearchEnums.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+namespace baba_is_auto
+{
+//! The actions that solvers try at each state.
+constexpr std::array<Direction, 4> SEARCH_ACTIONS = {
+    Direction::UP, Direction::DOWN, Direction::LEFT, Direction::RIGHT
+};
+
+//! \brief The bounds of a search. Zero means unbounded.
+struct SearchLimits
+{
+    std::size_t maxNodes = 0;
+    double maxSeconds = 0.0;
+};
+
+//! \brief The statistics of the last search.
+struct SearchStats
+{
+    //! The number of states whose successors were generated.
+    std::size_t nodesExpanded = 0;
+
+    //! The number of successor states generated.
+    std::size_t nodesGenerated = 0;
+
+    //! The number of distinct states that were kept, if the search keeps
+    //! them.
+    std::size_t statesVisited = 0;
+
+    //! The approximate peak memory used by the search, in bytes.
+    std::size_t memoryBytes = 0;
+
+    //! The wall-clock time of the search, in seconds.
+    double elapsedSeconds = 0.0;
+
+    //! Gets the number of expanded nodes per second.
+    //! \return The number of expanded nodes per second.
+    double GetNodesPerSecond() const
+    {
+        return elapsedSeconds > 0.0
+                   ? static_cast<double>(nodesExpanded) / elapsedSeconds
+                   : 0.0;
+    }
+};
+
+//!
+//! \brief SolverAgent class.
+//!
+//! This class is the base of agents that search a sequence of actions that
+//! wins the game. GetAction searches from the given state and then follows
+//! the found sequence as long as the game goes as planned, searching again
+//! when it does not.
+//!
+class SolverAgent : public IAgent
+{
+ public:
+    //! Constructs solver agent with given \p limits.
+    //! \param limits The bounds of each search.
+    explicit SolverAgent(SearchLimits limits = SearchLimits());
+
+    //! Searches a sequence of actions that wins \p game.
+    //! \param game The game to solve. It is not modified.
+    //! \return The result of the search.
+    SearchStatus Solve(const Game& game);
+
+    //! Gets an action of agent.
+    //! \param state The current game state.
+    //! \return An action of agent, or Direction::NONE if it has no solution.
+    Direction GetAction(const Game& state) override;
+
+    //! Gets the sequence of actions found by the last search.
+    //! \return The sequence of actions found by the last search.
+    const std::vector<Direction>& GetSolution() const;
+
+    //! Gets the statistics of the last search.
+    //! \return The statistics of the last search.
+    const SearchStats& GetStats() const;
+
+    //! Gets the result of the last search.
+    //! \return The result of the last search.
+    SearchStatus GetStatus() const;
+
+    //! Gets the bounds of each search.
+    //! \return The bounds of each search.
+    const SearchLimits& GetLimits() const;
+
+    //! Sets the bounds of each search.
+    //! \param limits The bounds of each search.
+    void SetLimits(SearchLimits limits);
+
+ protected:
+    //! Searches a sequence of actions that wins \p game.
+    //! \param game The game to solve.
+    //! \param solution The sequence of actions to fill when it is solved.
+    //! \param stats The statistics to update while searching.
+    //! \return The result of the search.
+    virtual SearchStatus Search(const Game& game,
+                                std::vector<Direction>& solution,
+                                SearchStats& stats) = 0;
+
+    //! Checks the search has reached its bounds.
+    //! \param stats The statistics of the search.
+    //! \return The flag indicates that the search has reached its bounds.
+    bool IsLimitReached(const SearchStats& stats) const;
+
+    //! Gets the wall-clock time since the search started.
+    //! \return The wall-clock time since the search started, in seconds.
+    double GetElapsedSeconds() const;
+
+ private:
+    SearchLimits m_limits;
+    SearchStatus m_status = SearchStatus::NOT_STARTED;
+    SearchStats m_stats;
+    std::vector<Direction> m_solution;
+
+    // The hash of the state before each action of the solution.
+    std::vector<std::uint64_t> m_expectedHashes;
+    std::size_t m_nextAction = 0;
+
+    std::chrono::steady_clock::time_point m_startTime;
+};
+}  // namespace baba_is_auto
+
+#endif  // BABA_IS_AUTO_SOLVER_AGENT_HPP
@@ -7,12 +7,13 @@
 #ifndef BABA_IS_AUTO_GAME_ENUMS_HPP
 #define BABA_IS_AUTO_GAME_ENUMS_HPP
 
+#include <cstdint>
 #include <vector>
 
 namespace baba_is_auto
 {
 //! \brief An enumerator for identifying the object.
-enum class ObjectType
+enum class ObjectType : std::uint8_t
 {
     NOUN_TYPE,
 #define X(a) a,
@@ -155,7 +156,7 @@ enum class PlayState
 };
 
 //! \brief An enumerator for identifying the direction.
-enum class Direction
+enum class Direction : std::uint8_t
 {
     NONE,
     UP,
@@ -163,6 +164,41 @@ enum class Direction
     LEFT,
     RIGHT
 };
+
+//! \brief An enumerator for identifying the event of a step.
+enum class StepEventType : std::uint8_t
+{
+    MOVED,
+    REMOVED,
+    TYPE_CHANGED,
+    RULE_ADDED,
+    RULE_REMOVED,
+    PLAY_STATE_CHANGED
+};
+
+//! \brief An enumerator for identifying the phase of a step.
+enum class GamePhase : std::uint8_t
+{
+    STEP,
+    YOU,
+    MOVE,
+    SHIFT,
+    IS,
+    SINK,
+    HOT_AND_MELT,
+    DEFEAT,
+    RULES,
+    PLAY_STATE
+};
+
+//! \brief An enumerator for identifying the counter of the calls of a step.
+enum class GameCounter : std::uint8_t
+{
+    HAS_TYPE,
+    CAN_MOVE,
+    MOVABLE_BOARDS,
+    OBJECTS_SCANNED
+};
 }  // namespace baba_is_auto
 
 #endif  // BABA_IS_AUTO_WORD_ENUMS_HPP
@@ -0,0 +1,38 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef BABA_IS_AUTO_SEARCH_ENUMS_HPP
+#define BABA_IS_AUTO_SEARCH_ENUMS_HPP
+
+namespace baba_is_auto
+{
+//! \brief An enumerator for identifying the result of a search.
+enum class SearchStatus
+{
+    NOT_STARTED,
+    SOLVED,
+    UNSOLVABLE,
+    LIMIT_REACHED,
+};
+
+//! \brief An enumerator for identifying the algorithm of informed search.
+enum class SearchAlgorithm
+{
+    A_STAR,
+    IDA_STAR,
+};
+
+//! \brief An enumerator for identifying how MCTS shares work among threads.
+enum class MCTSParallelism
+{
+    //! Each thread grows its own tree, and the trees vote at the root.
+    ROOT,
+    //! All threads grow one tree, kept apart by virtual loss.
+    TREE,
+};
+}  // namespace baba_is_auto
+
+#endif  // BABA_IS_AUTO_SEARCH_ENUMS_HPP
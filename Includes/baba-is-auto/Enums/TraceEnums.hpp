@@ -0,0 +1,34 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef BABA_IS_AUTO_TRACE_ENUMS_HPP
+#define BABA_IS_AUTO_TRACE_ENUMS_HPP
+
+namespace baba_is_auto
+{
+//! \brief An enumerator for identifying the severity of a trace record.
+enum class TraceLevel
+{
+    VERBOSE,
+    INFO,
+    WARNING,
+    FATAL
+};
+
+//! \brief An enumerator for identifying the subsystem that emits a trace.
+enum class TraceCategory
+{
+    MAP,
+    RULE,
+    GAME,
+    AGENT
+};
+
+//! The number of trace categories.
+constexpr int NUM_TRACE_CATEGORIES = 4;
+}  // namespace baba_is_auto
+
+#endif  // BABA_IS_AUTO_TRACE_ENUMS_HPP
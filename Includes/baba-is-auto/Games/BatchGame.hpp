@@ -0,0 +1,139 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef BABA_IS_AUTO_BATCH_GAME_HPP
+#define BABA_IS_AUTO_BATCH_GAME_HPP
+
+#include <baba-is-auto/Agents/ObservationEncoder.hpp>
+#include <baba-is-auto/Games/Game.hpp>
+#include <baba-is-auto/Utils/ThreadPool.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace baba_is_auto
+{
+//! \brief The rewards of a step of BatchGame.
+struct StepRewards
+{
+    //! The reward of a step that wins the game.
+    float win = 200.0f;
+
+    //! The reward of a step that loses the game.
+    float lose = -100.0f;
+
+    //! The reward of any other step.
+    float step = -0.5f;
+};
+
+//!
+//! \brief BatchGame class.
+//!
+//! This class owns many games of the same map and steps all of them with one
+//! call, so that a vectorized environment does not pay for a call per game.
+//! After each step the observations (the tensor of each game encoded by an
+//! ObservationEncoder, one after another), the rewards and the done flags are
+//! kept in contiguous buffers. A game that is done is reset right away, so
+//! its observation is the first one of the next episode; GetPlayStates tells
+//! how it ended.
+//!
+class BatchGame
+{
+ public:
+    //! Constructs batch game with given \p filename and \p numGames.
+    //! \param filename The file name of the map to play.
+    //! \param numGames The number of games.
+    //! \param numThreads The number of threads that step the games. Zero
+    //! means the number of hardware threads.
+    //! \param rewards The rewards of each step.
+    //! \param maxEpisodeSteps The number of steps after which an episode is
+    //! done without an end. Zero means unbounded.
+    //! \param encoder The encoder of the observations, or nullptr for the
+    //! layout of Preprocess.
+    BatchGame(std::string_view filename, std::size_t numGames,
+              std::size_t numThreads = 1, StepRewards rewards = StepRewards(),
+              std::size_t maxEpisodeSteps = 0,
+              std::shared_ptr<const ObservationEncoder> encoder = nullptr);
+
+    //! Resets all games and their observations.
+    void Reset();
+
+    //! Moves the player of each game and resets the games that are done.
+    //! \param actions The action of each game, GetNumGames() of them.
+    void Step(const Direction* actions);
+
+    //! Moves the player of each game and resets the games that are done.
+    //! \param actions The action of each game, GetNumGames() of them.
+    void Step(const std::vector<Direction>& actions);
+
+    //! Gets the number of games.
+    //! \return The number of games.
+    std::size_t GetNumGames() const;
+
+    //! Gets the encoder of the observations.
+    //! \return The encoder of the observations.
+    const ObservationEncoder& GetEncoder() const;
+
+    //! Gets the number of floats of the observation of a game.
+    //! \return The number of floats of the observation of a game.
+    std::size_t GetObservationSize() const;
+
+    //! Gets the game at \p idx.
+    //! \param idx The index of the game.
+    //! \return The game at \p idx.
+    Game& GetGame(std::size_t idx);
+
+    //! Gets the game at \p idx.
+    //! \param idx The index of the game.
+    //! \return The game at \p idx.
+    const Game& GetGame(std::size_t idx) const;
+
+    //! Gets the observations of all games, one after another.
+    //! \return The observations of all games.
+    const std::vector<float>& GetObservations() const;
+
+    //! Gets the reward of each game of the last step.
+    //! \return The reward of each game.
+    const std::vector<float>& GetRewards() const;
+
+    //! Gets the flag of each game that its episode ended at the last step.
+    //! \return The done flag of each game.
+    const std::vector<std::uint8_t>& GetDones() const;
+
+    //! Gets the play state of each game after the last step, before the
+    //! games that are done are reset. A game that is done while playing has
+    //! reached the maximum number of steps.
+    //! \return The play state of each game.
+    const std::vector<PlayState>& GetPlayStates() const;
+
+    //! Gets the number of steps of the current episode of each game.
+    //! \return The number of steps of each game.
+    const std::vector<std::size_t>& GetEpisodeSteps() const;
+
+ private:
+    void ResetGame(std::size_t idx);
+
+    // The number of games a thread takes at a time.
+    static constexpr std::size_t GAMES_PER_TASK = 4;
+
+    std::vector<Game> m_games;
+    ThreadPool m_pool;
+    StepRewards m_rewards;
+    std::size_t m_maxEpisodeSteps;
+    std::shared_ptr<const ObservationEncoder> m_encoder;
+    std::size_t m_observationSize;
+
+    std::vector<float> m_observations;
+    std::vector<float> m_stepRewards;
+    std::vector<std::uint8_t> m_dones;
+    std::vector<PlayState> m_playStates;
+    std::vector<std::size_t> m_episodeSteps;
+};
+}  // namespace baba_is_auto
+
+#endif  // BABA_IS_AUTO_BATCH_GAME_HPP
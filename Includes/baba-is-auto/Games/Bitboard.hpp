@@ -0,0 +1,161 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef BABA_IS_AUTO_BITBOARD_HPP
+#define BABA_IS_AUTO_BITBOARD_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace baba_is_auto
+{
+//! Gets the index of the lowest set bit of \p word.
+//! \param word The word that is not zero.
+//! \return The index of the lowest set bit.
+inline int CountTrailingZeros(std::uint64_t word)
+{
+#ifdef _MSC_VER
+    unsigned long idx = 0;
+    _BitScanForward64(&idx, word);
+    return static_cast<int>(idx);
+#else
+    return __builtin_ctzll(word);
+#endif
+}
+
+//! Gets the number of set bits of \p word.
+//! \param word The word to count.
+//! \return The number of set bits.
+inline int PopCount(std::uint64_t word)
+{
+#ifdef _MSC_VER
+    return static_cast<int>(__popcnt64(word));
+#else
+    return __builtin_popcountll(word);
+#endif
+}
+
+//!
+//! \brief Bitboard class.
+//!
+//! This class is a set of squares of a map. Square (x, y) is the bit
+//! y * width + x, so iterating the set visits squares in row-major order.
+//!
+class Bitboard
+{
+ public:
+    //! Default constructor.
+    Bitboard() = default;
+
+    //! Constructs an empty bitboard with given \p numBits.
+    //! \param numBits The number of squares.
+    explicit Bitboard(std::size_t numBits);
+
+    //! Constructs a bitboard from the words of another bitboard.
+    //! \param numBits The number of squares.
+    //! \param words The words to copy, (numBits + 63) / 64 of them.
+    Bitboard(std::size_t numBits, const std::uint64_t* words);
+
+    //! Gets the number of squares.
+    //! \return The number of squares.
+    std::size_t GetNumBits() const
+    {
+        return m_numBits;
+    }
+
+    //! Gets the words of the bitboard.
+    //! \return The words of the bitboard.
+    const std::vector<std::uint64_t>& GetWords() const
+    {
+        return m_words;
+    }
+
+    bool Test(std::size_t idx) const
+    {
+        return (m_words[idx >> 6] >> (idx & 63)) & 1;
+    }
+
+    void Set(std::size_t idx)
+    {
+        m_words[idx >> 6] |= std::uint64_t{ 1 } << (idx & 63);
+    }
+
+    void Reset(std::size_t idx)
+    {
+        m_words[idx >> 6] &= ~(std::uint64_t{ 1 } << (idx & 63));
+    }
+
+    //! Clears all squares.
+    void Clear();
+
+    //! Checks any square is set.
+    //! \return The flag indicates that any square is set.
+    bool Any() const;
+
+    //! Gets the number of set squares.
+    //! \return The number of set squares.
+    std::size_t Count() const;
+
+    //! Merges the words of another bitboard into this one.
+    //! \param words The words to merge, as many as this bitboard has.
+    void OrWords(const std::uint64_t* words);
+
+    Bitboard& operator|=(const Bitboard& rhs);
+    Bitboard& operator&=(const Bitboard& rhs);
+
+    //! Removes the squares of \p rhs from this bitboard.
+    //! \param rhs The squares to remove.
+    //! \return This bitboard.
+    Bitboard& AndNot(const Bitboard& rhs);
+
+    //! Flips all squares.
+    //! \return This bitboard.
+    Bitboard& Flip();
+
+    //! Moves each square to the square \p n before it, so square i gets the
+    //! bit of square i + n. Bits shifted in from past the end are zero.
+    //! \param n The number of squares to shift.
+    //! \return This bitboard.
+    Bitboard& ShiftRight(std::size_t n);
+
+    //! Moves each square to the square \p n after it, so square i gets the
+    //! bit of square i - n. Bits shifted past the end are dropped.
+    //! \param n The number of squares to shift.
+    //! \return This bitboard.
+    Bitboard& ShiftLeft(std::size_t n);
+
+    bool operator==(const Bitboard& rhs) const;
+
+    //! Calls \p func with the index of each set square in increasing order.
+    //! \param func The function to call.
+    template <typename Func>
+    void ForEach(Func&& func) const
+    {
+        for (std::size_t i = 0; i < m_words.size(); ++i)
+        {
+            std::uint64_t word = m_words[i];
+            while (word != 0)
+            {
+                func((i << 6) + CountTrailingZeros(word));
+                word &= word - 1;
+            }
+        }
+    }
+
+ private:
+    void ClearUnusedBits();
+
+    std::size_t m_numBits = 0;
+    std::vector<std::uint64_t> m_words;
+};
+}  // namespace baba_is_auto
+
+#endif  // BABA_IS_AUTO_BITBOARD_HPP
@@ -7,9 +7,15 @@
 #ifndef BABA_IS_AUTO_GAME_HPP
 #define BABA_IS_AUTO_GAME_HPP
 
+#include <baba-is-auto/Games/GameProfile.hpp>
+#include <baba-is-auto/Games/LevelTemplate.hpp>
 #include <baba-is-auto/Games/Map.hpp>
+#include <baba-is-auto/Games/MoveResolver.hpp>
+#include <baba-is-auto/Games/StepEvent.hpp>
 #include <baba-is-auto/Rules/RuleManager.hpp>
 
+#include <chrono>
+#include <memory>
 #include <string>
 #include <iterator>
 #include <iostream>
@@ -19,6 +25,10 @@
 
 namespace baba_is_auto
 {
+//! The state of a game that changes while playing, as a flat blob of bytes.
+//! It is made by Game::Snapshot and put back by Game::Restore.
+using GameSnapshot = ByteBuffer;
+
 //!
 //! \brief Game class.
 //!
@@ -31,9 +41,23 @@ class Game
     //! \param filename The file name to load a map.
     explicit Game(std::string_view filename);
 
-    //! Resets map and rule data.
+    //! Constructs game with the level at \p idx of \p corpus.
+    //! \param corpus The corpus of levels.
+    //! \param idx The index of the level.
+    Game(const LevelCorpus& corpus, std::size_t idx);
+
+    //! Constructs game with given \p level, which is shared with the other
+    //! games made from it.
+    //! \param level The template of the level.
+    explicit Game(std::shared_ptr<const LevelTemplate> level);
+
+    //! Resets map and rule data to the template of the level.
     void Reset();
 
+    //! Gets the template of the level.
+    //! \return The template of the level.
+    const std::shared_ptr<const LevelTemplate>& GetTemplate() const;
+
     //! Gets a map object.
     //! \return A map object.
     Map& GetMap();
@@ -46,18 +70,86 @@ class Game
     //! \return A rule manager object.
     RuleManager& GetRuleManager();
 
+    //! Gets a rule manager object.
+    //! \return A rule manager object.
+    const RuleManager& GetRuleManager() const;
+
     //! Gets the play state of the game.
     //! \return The play state of the game.
     PlayState GetPlayState() const;
 
+    //! Gets the hash of the state of the game. Object ids are not hashed, so
+    //! the games that look the same have the same hash.
+    //! \return The hash of the state of the game.
+    std::uint64_t Hash() const;
+
+    //! Takes a snapshot of the state of the game that changes while playing.
+    //! The map that is loaded and the random engine are not part of it.
+    //! \return The snapshot of the game.
+    GameSnapshot Snapshot() const;
+
+    //! Takes a snapshot of the state of the game into \p snapshot, reusing
+    //! its memory.
+    //! \param snapshot The snapshot to overwrite.
+    void Snapshot(GameSnapshot& snapshot) const;
+
+    //! Restores the state of the game from \p snapshot taken from a game of
+    //! the same map. The whole snapshot is checked first, so it can be used
+    //! on bytes from anywhere.
+    //! \param snapshot The snapshot to restore.
+    //! \throw std::invalid_argument if \p snapshot is not a valid snapshot of
+    //! a game of the same map. The game is not changed then.
+    void Restore(const GameSnapshot& snapshot);
+
+    //! Restores the state of the game from \p snapshot without checking it,
+    //! as searches do on their own snapshots. The cost is proportional to the
+    //! size of the map.
+    //! \param snapshot The snapshot to restore. It must be taken by Snapshot
+    //! of a game of the same map.
+    void RestoreTrusted(const GameSnapshot& snapshot);
+
     //! Gets an icon type that represents player.
     //! \return An icon type that represents player.
     // ObjectType GetPlayerIcons() const;
 
-    //! Moves the icon that represents player.
+    //! Moves the icon that represents player. Afterwards the dirty squares
+    //! of the map are the ones this step has changed.
     //! \param dir The direction to move the player.
     void MovePlayer(Direction dir);
 
+    //! Sets whether MovePlayer records the events of each step. Recording is
+    //! off by default, so a step does not pay for it unless asked.
+    //! \param isRecording The flag indicates that events are recorded.
+    void SetRecordEvents(bool isRecording);
+
+    //! Checks MovePlayer records the events of each step.
+    //! \return The flag indicates that events are recorded.
+    bool IsRecordingEvents() const;
+
+    //! Gets the events of the last MovePlayer in the order they happened,
+    //! with the changes of rules and of the play state last. The buffer is
+    //! reused by each step.
+    //! \return The events of the last step.
+    const std::vector<StepEvent>& GetEvents() const;
+
+    //! Sets whether MovePlayer measures the wall time of its phases and
+    //! counts its hot calls. Profiling is off by default, and a step that
+    //! does not profile only pays for a check of the flag.
+    //! \param isProfiling The flag indicates that steps are profiled.
+    void SetProfiling(bool isProfiling);
+
+    //! Checks MovePlayer profiles each step.
+    //! \return The flag indicates that steps are profiled.
+    bool IsProfiling() const;
+
+    //! Gets the statistics of the steps profiled so far. They are kept when
+    //! profiling is turned off, until ResetProfile is called.
+    //! \return The profile of the steps.
+    const GameProfile& GetProfile() const;
+
+    //! Clears the statistics of the steps profiled so far.
+    void ResetProfile();
+
     // Object& GetObject(std::size_t obj_id, std::size_t x, std::size_t y);
     std::vector<PositionalObject> FindObjectIdsAndPositionsByType(ObjectType property);
 
@@ -78,7 +170,7 @@ class Game
     //! \param y The y position.
     //! \param dir The direction to move.
     //! \return The flag indicates that an object can move.
-    bool CanMove(std::size_t x, std::size_t y, Direction dir, const Object& obj) const;
+    bool CanMove(std::size_t x, std::size_t y, Direction dir);
 
     //! Processes the move of the player.
     //! \param x The x position.
@@ -101,17 +193,59 @@ class Game
     //! Checks the play state of the game.
     void CheckPlayState();
     void SetPushedDirToObjects(std::size_t x, std::size_t y, Direction dir);
-    Direction SetRandomDirectionToObject(Object&);
+    Direction SetRandomDirectionToObject(ObjectSlot slot);
     void ResolveAllMoveFlags();
     void ResolveAllRemoveFlags();
     void ResolveAllChangeFlags();
-
+    void RecordRuleEvents(const std::vector<Rule>& prevRules);
+
+    //! Checks objects of a type have a property, counting the call when
+    //! profiling.
+    bool HasType(ObjectType objType, ObjectType property)
+    {
+        if (m_isProfiling)
+        {
+            m_profile.AddCount(GameCounter::HAS_TYPE);
+        }
+
+        return m_ruleManager.HasType(objType, property);
+    }
+
+    //! Runs \p func as \p phase, measuring its wall time when profiling.
+    template <typename Func>
+    void RunPhase(GamePhase phase, Func&& func)
+    {
+        if (!m_isProfiling)
+        {
+            func();
+            return;
+        }
+
+        const auto begin = std::chrono::steady_clock::now();
+        func();
+        const auto end = std::chrono::steady_clock::now();
+
+        m_profile.AddPhaseTime(
+            phase, static_cast<std::uint64_t>(
+                       std::chrono::duration_cast<std::chrono::nanoseconds>(
+                           end - begin)
+                           .count()));
+    }
+
+    std::shared_ptr<const LevelTemplate> m_template;
     Map m_map;
     RuleManager m_ruleManager;
+    MoveResolver m_moveResolver;
     std::mt19937 mt;
 
     PlayState m_playState = PlayState::INVALID;
     // std::vector<ObjectType> m_playerIcons;
+
+    bool m_isRecordingEvents = false;
+    std::vector<StepEvent> m_events;
+
+    bool m_isProfiling = false;
+    GameProfile m_profile;
 };
 }  // namespace baba_is_auto
 
@@ -0,0 +1,103 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef BABA_IS_AUTO_GAME_PROFILE_HPP
+#define BABA_IS_AUTO_GAME_PROFILE_HPP
+
+#include <baba-is-auto/Enums/GameEnums.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace baba_is_auto
+{
+//!
+//! \brief GameProfile class.
+//!
+//! This class accumulates the wall time of the phases of the steps of a game
+//! and the counts of its hot calls. The times of each phase are kept in a
+//! histogram of 8 buckets per power of two nanoseconds, so a percentile is
+//! known within about 6%.
+//!
+//! A profile that is not enabled has no memory, so a game that does not
+//! profile copies it for free.
+//!
+class GameProfile
+{
+ public:
+    //! The number of phases.
+    static constexpr std::size_t NUM_PHASES =
+        static_cast<std::size_t>(GamePhase::PLAY_STATE) + 1;
+
+    //! The number of counters.
+    static constexpr std::size_t NUM_COUNTERS =
+        static_cast<std::size_t>(GameCounter::OBJECTS_SCANNED) + 1;
+
+    //! Makes room for the statistics, if it has not been done.
+    void Enable();
+
+    //! Checks the profile has room for the statistics.
+    //! \return The flag indicates that the profile is enabled.
+    bool IsEnabled() const;
+
+    //! Clears the statistics.
+    void Reset();
+
+    //! Adds a call of \p phase that took \p nanoseconds.
+    //! \param phase The phase.
+    //! \param nanoseconds The wall time of the call.
+    void AddPhaseTime(GamePhase phase, std::uint64_t nanoseconds);
+
+    //! Adds \p count to \p counter. The profile must be enabled.
+    //! \param counter The counter.
+    //! \param count The number to add.
+    void AddCount(GameCounter counter, std::uint64_t count = 1)
+    {
+        m_counters[static_cast<std::size_t>(counter)] += count;
+    }
+
+    //! Gets the number of calls of \p phase.
+    //! \param phase The phase.
+    //! \return The number of calls.
+    std::uint64_t GetNumCalls(GamePhase phase) const;
+
+    //! Gets the total wall time of \p phase.
+    //! \param phase The phase.
+    //! \return The total wall time in nanoseconds.
+    std::uint64_t GetTotalNanoseconds(GamePhase phase) const;
+
+    //! Gets the mean wall time of a call of \p phase.
+    //! \param phase The phase.
+    //! \return The mean wall time in nanoseconds, or zero without calls.
+    double GetMeanNanoseconds(GamePhase phase) const;
+
+    //! Gets a percentile of the wall time of a call of \p phase.
+    //! \param phase The phase.
+    //! \param percentile The percentile, from 0 to 100.
+    //! \return The wall time in nanoseconds, or zero without calls.
+    double GetPercentileNanoseconds(GamePhase phase, double percentile) const;
+
+    //! Gets the count of \p counter.
+    //! \param counter The counter.
+    //! \return The count.
+    std::uint64_t GetCount(GameCounter counter) const;
+
+ private:
+    static std::size_t ToBucket(std::uint64_t nanoseconds);
+    static double GetBucketMiddle(std::size_t bucket);
+
+    // 8 buckets for the times below 8 ns, then 8 per power of two up to
+    // 2^40 ns.
+    static constexpr std::size_t NUM_BUCKETS = 304;
+
+    std::vector<std::uint64_t> m_numCalls;
+    std::vector<std::uint64_t> m_totalNanoseconds;
+    std::vector<std::uint64_t> m_histograms;
+    std::vector<std::uint64_t> m_counters;
+};
+}  // namespace baba_is_auto
+
+#endif  // BABA_IS_AUTO_GAME_PROFILE_HPP
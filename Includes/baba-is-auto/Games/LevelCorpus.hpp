@@ -0,0 +1,70 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef BABA_IS_AUTO_LEVEL_CORPUS_HPP
+#define BABA_IS_AUTO_LEVEL_CORPUS_HPP
+
+#include <baba-is-auto/Games/LevelFormat.hpp>
+#include <baba-is-auto/Games/Map.hpp>
+#include <baba-is-auto/Utils/MappedFile.hpp>
+
+#include <string_view>
+
+namespace baba_is_auto
+{
+//!
+//! \brief LevelCorpus class.
+//!
+//! This class maps a corpus of levels into memory. Only the header and the
+//! entries are checked when it is opened; a level is found through its entry
+//! and read from the mapped bytes when it is loaded, so opening a level does
+//! not depend on the number of levels.
+//!
+class LevelCorpus
+{
+ public:
+    //! Constructs level corpus with given \p filename.
+    //! \param filename The file name of the corpus.
+    explicit LevelCorpus(std::string_view filename);
+
+    //! Gets the number of levels.
+    //! \return The number of levels.
+    std::size_t GetNumLevels() const;
+
+    //! Gets the name of the level at \p idx.
+    //! \param idx The index of the level.
+    //! \return The name of the level, a view of the mapped bytes.
+    std::string_view GetName(std::size_t idx) const;
+
+    //! Finds the level that has \p name.
+    //! \param name The name of the level.
+    //! \return The index of the level, or GetNumLevels() if there is none.
+    std::size_t FindLevel(std::string_view name) const;
+
+    //! Gets the bytes of the level at \p idx.
+    //! \param idx The index of the level.
+    //! \return The bytes of the level, a view of the mapped bytes.
+    const std::uint8_t* GetLevelData(std::size_t idx) const;
+
+    //! Gets the number of bytes of the level at \p idx.
+    //! \param idx The index of the level.
+    //! \return The number of bytes of the level.
+    std::size_t GetLevelSize(std::size_t idx) const;
+
+    //! Loads the level at \p idx into \p map.
+    //! \param idx The index of the level.
+    //! \param map The map to load into.
+    void LoadMap(std::size_t idx, Map& map) const;
+
+ private:
+    CorpusEntry GetEntry(std::size_t idx) const;
+
+    MappedFile m_file;
+    std::size_t m_numLevels = 0;
+};
+}  // namespace baba_is_auto
+
+#endif  // BABA_IS_AUTO_LEVEL_CORPUS_HPP
@@ -0,0 +1,106 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef BABA_IS_AUTO_LEVEL_FORMAT_HPP
+#define BABA_IS_AUTO_LEVEL_FORMAT_HPP
+
+#include <baba-is-auto/Utils/Serialization.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace baba_is_auto
+{
+class Map;
+
+//!
+//! \brief The binary format of a level.
+//!
+//! A level is a LevelHeader followed by width * height + 1 std::uint32_t
+//! offsets and numObjects LevelObject records. The objects on square i are
+//! the records offsets[i] ... offsets[i + 1] - 1, from bottom to top, so a
+//! square can have any number of objects, each with its direction. Square i
+//! is at (i % width, i / width). All values are little-endian, the byte
+//! order of every platform the library is built for.
+//!
+//! A corpus is a CorpusHeader followed by numLevels CorpusEntry records,
+//! then the names and the levels they point to. Levels are found through
+//! the entries, so a corpus that is mapped into memory opens a level in
+//! constant time.
+//!
+struct LevelHeader
+{
+    char magic[4];
+    std::uint16_t version;
+    std::uint16_t flags;
+    std::uint16_t width;
+    std::uint16_t height;
+    std::uint32_t numObjects;
+};
+
+//! \brief An object of a level.
+struct LevelObject
+{
+    std::uint8_t type;
+    std::uint8_t direction;
+};
+
+//! \brief The header of a corpus of levels.
+struct CorpusHeader
+{
+    char magic[4];
+    std::uint16_t version;
+    std::uint16_t flags;
+    std::uint32_t numLevels;
+    std::uint32_t reserved;
+};
+
+//! \brief The entry of a level in a corpus. Offsets are from the start of
+//! the corpus.
+struct CorpusEntry
+{
+    std::uint64_t offset;
+    std::uint64_t size;
+    std::uint64_t nameOffset;
+    std::uint32_t nameLength;
+    std::uint32_t reserved;
+};
+
+static_assert(sizeof(LevelHeader) == 16, "LevelHeader must be packed.");
+static_assert(sizeof(LevelObject) == 2, "LevelObject must be packed.");
+static_assert(sizeof(CorpusHeader) == 16, "CorpusHeader must be packed.");
+static_assert(sizeof(CorpusEntry) == 32, "CorpusEntry must be packed.");
+
+//! The magic number at the start of a level.
+constexpr char LEVEL_MAGIC[4] = { 'B', 'A', 'B', 'L' };
+
+//! The magic number at the start of a corpus.
+constexpr char CORPUS_MAGIC[4] = { 'B', 'A', 'B', 'C' };
+
+//! The version of the level and corpus formats.
+constexpr std::uint16_t LEVEL_FORMAT_VERSION = 1;
+
+//! Checks \p data starts with the magic number of a level.
+//! \param data The bytes to check.
+//! \param size The number of bytes.
+//! \return The flag indicates that \p data looks like a level.
+bool IsLevelData(const std::uint8_t* data, std::size_t size);
+
+//! Writes the objects of \p map, with their directions, as a level.
+//! \param map The map to write.
+//! \return The bytes of the level.
+ByteBuffer EncodeLevel(const Map& map);
+
+//! Writes \p levels with their \p names as a corpus.
+//! \param names The name of each level.
+//! \param levels The bytes of each level, made by EncodeLevel.
+//! \return The bytes of the corpus.
+ByteBuffer EncodeCorpus(const std::vector<std::string>& names,
+                        const std::vector<ByteBuffer>& levels);
+}  // namespace baba_is_auto
+
+#endif  // BABA_IS_AUTO_LEVEL_FORMAT_HPP
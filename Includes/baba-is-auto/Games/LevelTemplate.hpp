@@ -0,0 +1,58 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef BABA_IS_AUTO_LEVEL_TEMPLATE_HPP
+#define BABA_IS_AUTO_LEVEL_TEMPLATE_HPP
+
+#include <baba-is-auto/Games/LevelCorpus.hpp>
+#include <baba-is-auto/Games/Map.hpp>
+#include <baba-is-auto/Rules/RuleManager.hpp>
+
+#include <string_view>
+
+namespace baba_is_auto
+{
+//!
+//! \brief LevelTemplate class.
+//!
+//! This class is the initial state of a level: the map as it is loaded and
+//! the rules parsed from it. It is loaded once and shared read-only by the
+//! games made from it, which copy it when they are constructed or reset
+//! instead of loading the map and parsing the rules again.
+//!
+class LevelTemplate
+{
+ public:
+    //! Constructs level template with given \p filename.
+    //! \param filename The file name to load a map.
+    explicit LevelTemplate(std::string_view filename);
+
+    //! Constructs level template with the level at \p idx of \p corpus.
+    //! \param corpus The corpus of levels.
+    //! \param idx The index of the level.
+    LevelTemplate(const LevelCorpus& corpus, std::size_t idx);
+
+    //! Constructs level template with the current state of \p map.
+    //! \param map The map in its initial state.
+    explicit LevelTemplate(Map map);
+
+    //! Gets the map in its initial state.
+    //! \return The map in its initial state.
+    const Map& GetMap() const;
+
+    //! Gets the rules of the map in its initial state.
+    //! \return The rules of the map in its initial state.
+    const RuleManager& GetRuleManager() const;
+
+ private:
+    void Init();
+
+    Map m_map;
+    RuleManager m_ruleManager;
+};
+}  // namespace baba_is_auto
+
+#endif  // BABA_IS_AUTO_LEVEL_TEMPLATE_HPP
@@ -8,20 +8,105 @@
 #define BABA_IS_AUTO_MAP_HPP
 
 #include <baba-is-auto/Enums/GameEnums.hpp>
+#include <baba-is-auto/Enums/RuleEnums.hpp>
+#include <baba-is-auto/Games/Bitboard.hpp>
 #include <baba-is-auto/Games/Object.hpp>
+#include <baba-is-auto/Utils/Serialization.hpp>
 
+#include <cstdint>
+#include <memory>
 #include <string_view>
 #include <vector>
 
 namespace baba_is_auto
 {
-// using Position = std::pair<std::size_t, std::size_t>;
+//! The index of an object in the object pool of a map.
+using ObjectSlot = std::uint32_t;
+
+//!
+//! \brief SlotRange class.
+//!
+//! This class is a view of the object slots that lie on a square. The view is
+//! invalidated when an object is added to, removed from or moved on the map.
+//!
+class SlotRange
+{
+ public:
+    //! Constructs slot range with given \p begin and \p end.
+    //! \param begin The pointer to the first slot.
+    //! \param end The pointer past the last slot.
+    SlotRange(const ObjectSlot* begin, const ObjectSlot* end)
+        : m_begin(begin), m_end(end)
+    {
+        // Do nothing
+    }
+
+    const ObjectSlot* begin() const
+    {
+        return m_begin;
+    }
+
+    const ObjectSlot* end() const
+    {
+        return m_end;
+    }
+
+    std::size_t size() const
+    {
+        return static_cast<std::size_t>(m_end - m_begin);
+    }
+
+    bool empty() const
+    {
+        return m_begin == m_end;
+    }
+
+    ObjectSlot operator[](std::size_t idx) const
+    {
+        return m_begin[idx];
+    }
+
+ private:
+    const ObjectSlot* m_begin;
+    const ObjectSlot* m_end;
+};
 
 //!
 //! \brief Map class.
 //!
 //! This class represents map. A map is a board of the game.
 //!
+//! Objects are stored in a single pool as a structure of arrays (id, type,
+//! direction, flags and square index), and each square refers to its objects
+//! by a range of slots in a flat index. A slot is stable while the object
+//! lives, so it can be used as a handle within a pass of the game.
+//!
+//! Each square has room for more slots than it uses, so adding, removing or
+//! moving an object only shifts the slots of the squares it touches. A
+//! square that runs out of room moves to the end of the index with twice the
+//! room, and the room left behind is reclaimed once it is more than half of
+//! the index.
+//!
+//! The id of an object is its slot, and the slot of a removed object is
+//! given to the next object added. Ids are therefore less than the largest
+//! number of objects the map has had at once, they are the same after each
+//! reset, and maps on other threads do not share a counter. An object is
+//! found by its id in constant time.
+//!
+//! The map also keeps a bitboard of occupied squares for each icon type and
+//! one for all text objects, updated whenever an object is added, removed,
+//! moved or changed.
+//!
+//! Rows and columns whose text objects change are marked dirty until
+//! ClearDirtyLines is called, so rules can be re-parsed only on those lines.
+//! In the same way, squares whose objects or rule flags change are listed
+//! until ClearDirtyCells is called, so an observation can be patched only on
+//! those squares.
+//!
+//! A Zobrist hash of the objects (square, type and direction, but not id) is
+//! updated with each change as well. The keys of the objects are added
+//! instead of XORed, so two same objects on a square do not cancel out.
+//!
 class Map
 {
  public:
@@ -33,13 +118,29 @@ class Map
     //! \param height The size of the height.
     Map(std::size_t width, std::size_t height);
 
-    //! Loads the data of the map.
+    //! Loads the data of the map from a text file of the width, the height
+    //! and the type of each square, or from a file of a binary level.
     //! \param filename The file name to load.
     void Load(std::string_view filename);
 
-    //! Resets map data.
+    //! Loads the data of the map from a binary level (see LevelFormat.hpp).
+    //! \param data The bytes of the level.
+    //! \param size The number of bytes.
+    void LoadLevel(const std::uint8_t* data, std::size_t size);
+
+    //! Resets map data to the initial state.
     void Reset();
 
+    //! Makes the current state the initial state that Reset puts back.
+    //! Copies of the map share the initial state, so it is not copied.
+    void SaveInitState();
+
+    //! Checks the map shares its initial state with \p other, as copies of
+    //! a map do.
+    //! \param other The map to check.
+    //! \return The flag indicates that the initial state is shared.
+    bool SharesInitState(const Map& other) const;
+
     //! Gets the width of the map.
     //! \return The width of the map.
     inline std::size_t GetWidth() const { return m_width; }
@@ -51,44 +152,309 @@ class Map
     //! Adds an object to the map.
     //! \param x The x position.
     //! \param y The y position.
-    //! \param type An object type to add to the map.
+    //! \param obj An object to add to the map.
     void AddObject(std::size_t x, std::size_t y, const Object& obj);
 
     //! Removes an object from the map.
     //! \param x The x position.
     //! \param y The y position.
-    //! \param type An object type to remove from the map.
+    //! \param obj An object to remove from the map.
     void RemoveObject(std::size_t x, std::size_t y, const Object& obj);
 
-    //! Assigns an object to the map.
+    //! Removes the object at \p slot from the map.
+    //! \param slot The slot of the object to remove.
+    void RemoveObject(ObjectSlot slot);
+
+    //! Moves an object to another square.
+    //! \param slot The slot of the object to move.
+    //! \param x The x position to move to.
+    //! \param y The y position to move to.
+    void MoveObject(ObjectSlot slot, std::size_t x, std::size_t y);
+
+    //! Gets a copy of the square at (x, y).
     //! \param x The x position.
     //! \param y The y position.
-    //! \return An object at row and column.
-    Square& At(std::size_t x, std::size_t y);
+    //! \return A copy of the square at (x, y).
+    Square At(std::size_t x, std::size_t y) const;
 
-    //! Assigns an object to the map.
+    //! Gets the slots of the objects at (x, y).
     //! \param x The x position.
     //! \param y The y position.
-    //! \return An object at row and column.
-    const Square& At(std::size_t x, std::size_t y) const;
+    //! \return The slots of the objects at (x, y).
+    SlotRange GetSlots(std::size_t x, std::size_t y) const;
+
+    //! Gets the slot of the object that has \p objId in constant time.
+    //! \param objId The id of the object.
+    //! \return The slot of the object, or INVALID_SLOT if the object is not
+    //! on the map.
+    ObjectSlot GetSlot(ObjectId objId) const;
 
-    // //! Gets a list of icon positions.
-    // //! \param type An object type to get a list of positions.
-    // //! \return A list of icon positions.
-    // // std::vector<Position> GetPositions(ObjectType type) const;
-    Object& GetObject(ObjectId obj_id, std::size_t x, std::size_t y);
-    const ObjectContainer& GetObjects(std::size_t x, std::size_t y)  const;
-    ObjectContainer& GetObjects(std::size_t x, std::size_t y);
+    //! Finds the slot of the object that has \p objId at (x, y).
+    //! \param objId The id of the object.
+    //! \param x The x position.
+    //! \param y The y position.
+    //! \return The slot of the object.
+    ObjectSlot FindSlot(ObjectId objId, std::size_t x, std::size_t y) const;
+
+    //! Gets a copy of the object at \p slot.
+    //! \param slot The slot of the object.
+    //! \return A copy of the object.
+    Object GetObject(ObjectSlot slot) const;
+
+    //! Gets copies of the objects at (x, y).
+    //! \param x The x position.
+    //! \param y The y position.
+    //! \return Copies of the objects at (x, y).
+    ObjectContainer GetObjects(std::size_t x, std::size_t y) const;
 
-    // bool HasTextType(std::size_t x, std::size_t y) const;
+    inline ObjectId GetId(ObjectSlot slot) const
+    {
+        return static_cast<ObjectId>(slot);
+    }
+
+    inline ObjectType GetType(ObjectSlot slot) const
+    {
+        return m_state.types[slot];
+    }
+
+    inline Direction GetDirection(ObjectSlot slot) const
+    {
+        return m_state.directions[slot];
+    }
+
+    inline Direction GetMoveFlag(ObjectSlot slot) const
+    {
+        return m_state.moveFlags[slot];
+    }
+
+    inline bool GetRemoveFlag(ObjectSlot slot) const
+    {
+        return m_state.removeFlags[slot] != 0;
+    }
+
+    inline ObjectType GetChangeFlag(ObjectSlot slot) const
+    {
+        return m_state.changeFlags[slot];
+    }
+
+    void SetType(ObjectSlot slot, ObjectType type);
+    void SetDirection(ObjectSlot slot, Direction dir);
+
+    inline void SetMoveFlag(ObjectSlot slot, Direction dir)
+    {
+        m_state.moveFlags[slot] = dir;
+    }
+
+    inline void SetRemoveFlag(ObjectSlot slot, bool flag)
+    {
+        m_state.removeFlags[slot] = flag ? 1 : 0;
+    }
+
+    inline void SetChangeFlag(ObjectSlot slot, ObjectType type)
+    {
+        m_state.changeFlags[slot] = type;
+    }
+
+    //! Checks the square at (x, y) is a part of a valid rule.
+    //! \param x The x position.
+    //! \param y The y position.
+    //! \return The flag indicates that the square is a part of a rule.
+    bool IsRule(std::size_t x, std::size_t y) const;
+
+    //! Sets the flag that the square at (x, y) is a part of a valid rule
+    //! read in \p direction.
+    //! \param x The x position.
+    //! \param y The y position.
+    //! \param direction The direction of the rule.
+    //! \param flag The flag indicates that the square is a part of a rule.
+    void SetRule(std::size_t x, std::size_t y, RuleDirection direction,
+                 bool flag);
+
+    //! Checks any row or column has changed text objects since the last call
+    //! of ClearDirtyLines.
+    //! \return The flag indicates that any line is dirty.
+    bool HasDirtyLines() const;
+
+    //! Checks the row \p y has changed text objects.
+    //! \param y The y position of the row.
+    //! \return The flag indicates that the row is dirty.
+    bool IsDirtyRow(std::size_t y) const;
+
+    //! Checks the column \p x has changed text objects.
+    //! \param x The x position of the column.
+    //! \return The flag indicates that the column is dirty.
+    bool IsDirtyColumn(std::size_t x) const;
+
+    //! Marks all rows and columns dirty.
+    void MarkAllLinesDirty();
+
+    //! Marks all rows and columns clean.
+    void ClearDirtyLines();
+
+    //! Gets the squares whose objects or rule flags have changed since the
+    //! last call of ClearDirtyCells, as indices y * width + x, each once.
+    //! The list is empty when all squares are dirty.
+    //! \return The squares that have changed.
+    const std::vector<std::uint32_t>& GetDirtyCells() const;
+
+    //! Checks all squares are dirty, as after loading, resetting or reading
+    //! a state.
+    //! \return The flag indicates that all squares are dirty.
+    bool AreAllCellsDirty() const;
+
+    //! Marks all squares dirty.
+    void MarkAllCellsDirty();
+
+    //! Marks all squares clean.
+    void ClearDirtyCells();
+
+    //! Gets the hash of the objects on the map. Maps that have the same
+    //! objects on the same squares have the same hash, whatever their ids are.
+    //! \return The hash of the objects on the map.
+    std::uint64_t GetHash() const
+    {
+        return m_state.hash;
+    }
+
+    //! Computes the hash of the objects on the map from scratch.
+    //! \return The hash of the objects on the map.
+    std::uint64_t ComputeHash() const;
+
+    //! Appends the state of the map that changes while playing to \p out.
+    //! \param out The buffer to append to.
+    void WriteState(ByteBuffer& out) const;
+
+    //! Checks the state of the map written by WriteState can be read by
+    //! ReadState, without changing the map.
+    //! \param in The pointer to the state, advanced past it.
+    //! \param end The end of the bytes of the state.
+    //! \throw std::invalid_argument if the state is not a valid state of a
+    //! map of this size.
+    void CheckState(const std::uint8_t*& in, const std::uint8_t* end) const;
+
+    //! Reads the state of the map written by WriteState of a map of the same
+    //! size. A state that does not come from WriteState must pass CheckState
+    //! first. It does not allocate when the map had as many objects before.
+    //! \param in The pointer to the state, advanced past it.
+    //! \param end The end of the bytes of the state.
+    void ReadState(const std::uint8_t*& in, const std::uint8_t* end);
+
+    //! Checks the square at (x, y) has a text object.
+    //! \param x The x position.
+    //! \param y The y position.
+    //! \return The flag indicates that the square has a text object.
+    bool HasTextType(std::size_t x, std::size_t y) const;
+
+    //! Gets the number of objects on the map.
+    //! \return The number of objects on the map.
+    std::size_t GetNumObjects() const;
+
+    //! Gets the number of ids given to objects, including the ids of removed
+    //! objects that are kept for reuse. All ids are less than it, so they can
+    //! index a table of this size.
+    //! \return The number of ids given to objects.
+    std::size_t GetNumObjectIds() const;
+
+    //! Gets the squares that have an object of \p type.
+    //! \param type An icon type, or ObjectType::TEXT for all text objects.
+    //! \return The squares that have an object of \p type.
+    Bitboard GetBitboard(ObjectType type) const;
+
+    //! Merges the squares that have an object of \p type into \p board.
+    //! \param type An icon type, or ObjectType::TEXT for all text objects.
+    //! \param board The bitboard to merge into.
+    void MergeBitboard(ObjectType type, Bitboard& board) const;
+
+    //! The slot of an object that is not on the map.
+    static constexpr ObjectSlot INVALID_SLOT = UINT32_MAX;
+
+    //! The number of bitboards: one per icon type and one for text objects.
+    static constexpr std::size_t NUM_BITBOARDS =
+        static_cast<std::size_t>(ObjectType::GRAMMAR_TYPE) -
+        static_cast<std::size_t>(ObjectType::ICON_TYPE);
 
  private:
-    // std::size_t m_maxObjId = 0;
+    //! The slots of a square in the flat index, with room for capacity
+    //! slots from begin.
+    struct CellRange
+    {
+        std::uint32_t begin = 0;
+        std::uint32_t size = 0;
+        std::uint32_t capacity = 0;
+    };
+
+    //! The state of the map that changes while playing. All members are flat
+    //! arrays, so copying a state never allocates per square.
+    struct State
+    {
+        // Object pool indexed by slot. The cell of a free slot is
+        // INVALID_CELL.
+        std::vector<ObjectType> types;
+        std::vector<Direction> directions;
+        std::vector<Direction> moveFlags;
+        std::vector<ObjectType> changeFlags;
+        std::vector<std::uint8_t> removeFlags;
+        std::vector<std::uint32_t> cells;
+        std::vector<ObjectSlot> freeSlots;
+
+        // The slots on square i are cellObjects[cellRanges[i].begin] ...
+        // cellObjects[cellRanges[i].begin + cellRanges[i].size - 1].
+        std::vector<CellRange> cellRanges;
+        std::vector<ObjectSlot> cellObjects;
+        std::uint32_t numUnusedObjects = 0;
+
+        // Bit 0 is for horizontal rules, bit 1 is for vertical rules.
+        std::vector<std::uint8_t> ruleFlags;
+
+        std::vector<std::uint8_t> dirtyRows;
+        std::vector<std::uint8_t> dirtyColumns;
+        bool hasDirtyLines = false;
+
+        std::uint64_t hash = 0;
+
+        // NUM_BITBOARDS bitboards of m_numWords words each.
+        std::vector<std::uint64_t> bitboards;
+    };
+
+    std::size_t ToCell(std::size_t x, std::size_t y) const;
+    SlotRange GetCellSlots(std::uint32_t cell) const;
+    ObjectSlot AllocateSlot(const Object& obj, std::uint32_t cell);
+    void FreeSlot(ObjectSlot slot);
+    void LinkSlot(std::uint32_t cell, ObjectSlot slot);
+    void UnlinkSlot(std::uint32_t cell, ObjectSlot slot);
+    void EndCell(std::uint32_t cell, std::uint32_t begin);
+    void GrowCell(std::uint32_t cell);
+    void CompactCells();
+    void RemoveAllByType(std::uint32_t cell, ObjectType type);
+    void FillEmptyCell(std::uint32_t cell);
+
+    static std::size_t ToBitboardIndex(ObjectType type);
+    void UpdateBitboard(std::uint32_t cell, ObjectType type);
+    void RebuildBitboards();
+
+    void MarkDirtyLines(std::uint32_t cell);
+    void MarkDirtyCell(std::uint32_t cell);
+    void FinishLoad();
+
+    static constexpr std::uint32_t INVALID_CELL = UINT32_MAX;
+
+    // The least room of a square, enough for an object to enter a square
+    // before its placeholder is removed.
+    static constexpr std::uint32_t MIN_CELL_CAPACITY = 2;
+
     std::size_t m_width = 0;
     std::size_t m_height = 0;
+    std::size_t m_numWords = 0;
+
+    // It never changes once saved, so copies of the map share it.
+    std::shared_ptr<const State> m_initState;
+    State m_state;
 
-    std::vector<Square> m_initSquares;
-    std::vector<Square> m_squares;
+    // The squares that have changed are not a part of the state, so putting
+    // a state back marks all squares dirty instead.
+    std::vector<std::uint32_t> m_dirtyCells;
+    std::vector<std::uint8_t> m_dirtyCellFlags;
+    bool m_allCellsDirty = true;
 };
 }  // namespace baba_is_auto
 
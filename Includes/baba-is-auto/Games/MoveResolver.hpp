@@ -0,0 +1,100 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef BABA_IS_AUTO_MOVE_RESOLVER_HPP
+#define BABA_IS_AUTO_MOVE_RESOLVER_HPP
+
+#include <baba-is-auto/Games/Bitboard.hpp>
+#include <baba-is-auto/Games/Map.hpp>
+#include <baba-is-auto/Rules/RuleManager.hpp>
+
+#include <array>
+#include <cstdint>
+
+namespace baba_is_auto
+{
+//!
+//! \brief MoveResolver class.
+//!
+//! This class tells which squares can move in a direction. An object can
+//! move when the square in front of it is on the map, has no STOP object,
+//! and either has no PUSH object or can move itself. Instead of following
+//! the chain of PUSH objects square by square, the movable squares of a
+//! direction are computed for the whole map at once from the bitboards of
+//! PUSH and STOP, with a logarithmic number of shifts along the rows or the
+//! columns.
+//!
+//! The squares are computed on demand and kept until Invalidate is called,
+//! so the caller invalidates them whenever a PUSH or STOP object is added,
+//! removed, moved or changed, or the rules change.
+//!
+class MoveResolver
+{
+ public:
+    //! Forgets the movable squares of all directions.
+    void Invalidate();
+
+    //! Forgets the movable squares if moving an object of \p type may change
+    //! them, that is, if it or an empty square is PUSH or STOP.
+    //! \param ruleManager The rules of the game.
+    //! \param type The type of the object that moved.
+    void NotifyMoved(const RuleManager& ruleManager, ObjectType type);
+
+    //! Checks the object at (x, y) can move to \p dir.
+    //! \param map The map of the game.
+    //! \param ruleManager The rules of the game.
+    //! \param x The x position.
+    //! \param y The y position.
+    //! \param dir The direction to move.
+    //! \return The flag indicates that the object can move.
+    bool CanMove(const Map& map, const RuleManager& ruleManager,
+                 std::size_t x, std::size_t y, Direction dir);
+
+    //! Gets the squares whose objects can move to \p dir.
+    //! \param map The map of the game.
+    //! \param ruleManager The rules of the game.
+    //! \param dir The direction to move, not Direction::NONE.
+    //! \return The squares whose objects can move.
+    const Bitboard& GetMovableBoard(const Map& map,
+                                    const RuleManager& ruleManager,
+                                    Direction dir);
+
+    //! Gets the number of times the movable squares of a direction have
+    //! been computed.
+    //! \return The number of computations.
+    std::uint64_t GetNumComputations() const
+    {
+        return m_numComputations;
+    }
+
+ private:
+    void Compute(const Map& map, const RuleManager& ruleManager,
+                 Direction dir);
+    void ComputeBlockers(const Map& map, const RuleManager& ruleManager);
+
+    static constexpr std::size_t NUM_DIRECTIONS = 4;
+
+    std::array<Bitboard, NUM_DIRECTIONS> m_movableBoards;
+    std::array<bool, NUM_DIRECTIONS> m_isValid{};
+
+    Bitboard m_pushBoard;
+    Bitboard m_stopBoard;
+    bool m_areBlockersValid = false;
+
+    // The first and the last column, which nothing crosses horizontally.
+    std::size_t m_width = 0;
+    std::size_t m_height = 0;
+    Bitboard m_firstColumn;
+    Bitboard m_lastColumn;
+
+    Bitboard m_propagate;
+    Bitboard m_shifted;
+
+    std::uint64_t m_numComputations = 0;
+};
+}  // namespace baba_is_auto
+
+#endif  // BABA_IS_AUTO_MOVE_RESOLVER_HPP
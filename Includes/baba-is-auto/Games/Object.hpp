@@ -39,8 +39,19 @@ class Object
 {
  public:
     Object() = default;
+
+    //! Constructs an object without an id. The map gives the object its id
+    //! when the object is added to it.
+    //! \param type The object type.
+    //! \param dir The direction of the object.
     explicit Object(ObjectType type, Direction dir=Direction::NONE); 
 
+    //! Constructs an object that keeps the given \p id.
+    //! \param type The object type.
+    //! \param dir The direction of the object.
+    //! \param id The id of the object.
+    Object(ObjectType type, Direction dir, ObjectId id);
+
     bool operator==(const Object& rhs) const;
 
     //ObjectId GetId() const { return m_id; }
@@ -57,7 +68,6 @@ class Object
     // void AddProperty(ObjectType type);
     // void RemoveProperty(ObjectType type);
 
-    ObjectId SetNewObjectId();
     inline void SetType(ObjectType type){ m_type = type; }
     inline void SetDirection(Direction dir){ m_direction = dir; }
     inline void SetMoveFlag(Direction dir) { m_move_direction = dir; }
@@ -65,7 +75,7 @@ class Object
     inline void SetChangeFlag(ObjectType type){ m_change_to=type; }
 
  private:
-    ObjectId m_id;
+    ObjectId m_id = 0;
     ObjectType m_type;
     Direction m_direction;
 
@@ -85,37 +95,25 @@ using ObjectContainer = std::vector<Object>;
 using PositionalObject = std::tuple<ObjectId, size_t, size_t>;
 
 
-// Squareの採用どうするか検討中。。。少なくともGame内で直接操作しないようにしよう
+//!
+//! \brief Square class.
+//!
+//! This class is a copy of the objects on a square of a map. The objects
+//! themselves are owned by the map, so changing a square does not change the
+//! map.
+//!
 class Square
 {
  public:
     //! Default constructor.
     Square() = default;
 
-    // Copy constructor.
-    Square(const Square&);
-
-    //! Constructs an object.
-    //! \param types A list of object types.
-    // explicit Square(std::size_t x, std::size_t y, std::vector<Object> objects);
+    //! Constructs a square.
+    //! \param x The x position.
+    //! \param y The y position.
+    //! \param objects A list of objects on the square.
     explicit Square(size_t x, size_t y, ObjectContainer objects);
 
-    //! Operator overloading for ==.
-    //! \param rhs A right side of Object object.
-    //! \return The value that indicates two objects are equal.
-    // bool operator==(const Object& rhs) const;
-
-    //! Adds an object type.
-    //! \param type An object type to add.
-    void AddObject(const Object& obj);
-
-    //! Removes an object type.
-    //! \param type An object type to remove.
-    void RemoveObject(const Object& obj);
-
-    void RemoveAllByType(ObjectType type);
-
-
     //! Checks the square has specific type.
     //! \param type An object type to check.
     //! \return The flag indicates that the object has specific type.
@@ -126,16 +124,16 @@ class Square
     bool HasTextType() const;
 
     bool isRule = false; // a flag showing whether the square consists a vaild rule.
-    const ObjectContainer& GetObjects() const;
-    ObjectContainer& GetObjects();
+    const ObjectContainer& GetObjects() const&;
+    ObjectContainer GetObjects() &&;
     ObjectContainer GetTextObjects() const;
 
     inline size_t X() const { return m_x; }
     inline size_t Y() const { return m_y; }
 
  private:
-    size_t m_x;
-    size_t m_y;
+    size_t m_x = 0;
+    size_t m_y = 0;
     ObjectContainer m_objects;
 
 };
@@ -0,0 +1,49 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef BABA_IS_AUTO_STEP_EVENT_HPP
+#define BABA_IS_AUTO_STEP_EVENT_HPP
+
+#include <baba-is-auto/Enums/GameEnums.hpp>
+#include <baba-is-auto/Games/Object.hpp>
+
+#include <cstdint>
+
+namespace baba_is_auto
+{
+//!
+//! \brief StepEvent struct.
+//!
+//! This struct is a change that a step of the game has made. Only the fields
+//! of its type are meaningful:
+//! - MOVED: id, objectType, (x, y) to (toX, toY).
+//! - REMOVED: id, objectType, (x, y).
+//! - TYPE_CHANGED: id, objectType to newType, (x, y).
+//! - RULE_ADDED, RULE_REMOVED: subject, op, predicate.
+//! - PLAY_STATE_CHANGED: playState, the new play state.
+//!
+struct StepEvent
+{
+    StepEventType type = StepEventType::MOVED;
+
+    ObjectId id = 0;
+    ObjectType objectType = ObjectType::ICON_EMPTY;
+    ObjectType newType = ObjectType::ICON_EMPTY;
+
+    std::uint16_t x = 0;
+    std::uint16_t y = 0;
+    std::uint16_t toX = 0;
+    std::uint16_t toY = 0;
+
+    ObjectType subject = ObjectType::ICON_EMPTY;
+    ObjectType op = ObjectType::ICON_EMPTY;
+    ObjectType predicate = ObjectType::ICON_EMPTY;
+
+    PlayState playState = PlayState::INVALID;
+};
+}  // namespace baba_is_auto
+
+#endif  // BABA_IS_AUTO_STEP_EVENT_HPP
@@ -12,6 +12,8 @@
 #include <baba-is-auto/Rules/Rule.hpp>
 #include <baba-is-auto/Games/Map.hpp>
 
+#include <array>
+#include <cstdint>
 #include <iostream>
 #include <string>
 #include <vector>
@@ -19,6 +21,27 @@
 
 namespace baba_is_auto
 {
+//! A set of properties. A property p is the bit (p - PROPERTY_TYPE - 1).
+using PropertyMask = std::uint64_t;
+
+static_assert(static_cast<int>(ObjectType::ICON_TYPE) -
+                      static_cast<int>(ObjectType::PROPERTY_TYPE) - 1 <=
+                  64,
+              "The properties do not fit in PropertyMask.");
+
+//! Gets the bit of \p property in PropertyMask.
+//! \param property The property type.
+//! \return The bit of \p property.
+constexpr PropertyMask ToPropertyBit(ObjectType property)
+{
+    return PropertyMask{ 1 }
+           << (static_cast<int>(property) -
+               static_cast<int>(ObjectType::PROPERTY_TYPE) - 1);
+}
+
+//! The table of the properties of each object type, indexed by ObjectType.
+using PropertyTable = std::array<PropertyMask, 256>;
+
 //!
 //! \brief RuleManager class.
 //!
@@ -57,17 +80,101 @@ class RuleManager
     //! \return The flag indicates that an object has specific property.
 
     bool HasType(const Object& obj, const Map& map, ObjectType type) const;
+
+    //! Checks objects of a type have specific property.
+    //! \param objType The type of objects.
+    //! \param type The property to check.
+    //! \return The flag indicates that the objects have specific property.
+    bool HasType(ObjectType objType, ObjectType type) const
+    {
+        return IsPropertyType(type) &&
+               (GetProperties(objType) & ToPropertyBit(type)) != 0;
+    }
+
+    //! Gets the properties of objects of a type.
+    //! \param objType The type of objects.
+    //! \return The properties of objects of \p objType.
+    PropertyMask GetProperties(ObjectType objType) const
+    {
+        return m_propertyTable[static_cast<std::size_t>(objType)];
+    }
+
+    //! Gets the table of the properties of each object type. The table is
+    //! updated whenever the rules change.
+    //! \return The table of the properties of each object type.
+    const PropertyTable& GetPropertyTable() const
+    {
+        return m_propertyTable;
+    }
+
+    //! Gets the squares that have an object with specific property.
+    //! \param map The map to find objects.
+    //! \param property The property to check.
+    //! \return The squares that have an object with specific property.
+    Bitboard GetPropertyBitboard(const Map& map, ObjectType property) const;
+
+    //! Parses all rules on the map from scratch.
+    //! \param map The map to parse rules.
     void ParseRules(Map& map);
+
+    //! Re-parses rules only on the rows and columns of the map that are
+    //! dirty, and merges them with the rules of the other lines parsed
+    //! before. It must be called with the map of the previous call.
+    //! \param map The map to parse rules.
+    void UpdateRules(Map& map);
+
+    //! Checks the last call of UpdateRules or ReadState has changed the
+    //! properties of any object type.
+    //! \return The flag indicates that the properties have changed.
+    bool HasChangedProperties() const
+    {
+        return m_hasChangedProperties;
+    }
+
+    //! Appends the rules and the rules of each line to \p out.
+    //! \param out The buffer to append to.
+    void WriteState(ByteBuffer& out) const;
+
+    //! Checks the rules written by WriteState can be read by ReadState,
+    //! without changing the rules.
+    //! \param in The pointer to the rules, advanced past them.
+    //! \param end The end of the bytes of the rules.
+    //! \param map The map of the rules.
+    //! \throw std::invalid_argument if the rules are not valid rules of
+    //! \p map.
+    void CheckState(const std::uint8_t*& in, const std::uint8_t* end,
+                    const Map& map) const;
+
+    //! Reads the rules written by WriteState. Rules that do not come from
+    //! WriteState must pass CheckState first.
+    //! \param in The pointer to the rules, advanced past them.
+    //! \param end The end of the bytes of the rules.
+    void ReadState(const std::uint8_t*& in, const std::uint8_t* end);
+
     void ParseRule(Map& map, std::size_t x, std::size_t y, RuleDirection direction);
     void BuildRuleTree(TypeSequence seq);
  private:
+    //! The rules on a line and the position of their first texts on it.
+    using LineRules = std::vector<std::pair<std::size_t, Rule>>;
+
+    void ParseLine(Map& map, std::size_t idx, RuleDirection direction);
+    void MergeLineRules();
+
+    std::vector<LineRules> m_rowRules;
+    std::vector<LineRules> m_columnRules;
     std::vector<Rule> m_rules;
-    std::vector<Grammar> m_grammars;
-    TypeSequence GetAllNouns();
-    TypeSequence GetAllGenVerbs();
-    TypeSequence GetAllProperties();
-    TypeSequence GetAllPreModifiers();
-    TypeSequence GetAllPostModifiers();
+    PropertyTable m_propertyTable{};
+    bool m_hasChangedProperties = true;
+
+    void AddToPropertyTable(const Rule& rule);
+    void RebuildPropertyTable();
+    static const std::vector<Grammar>& GetGrammars();
+    static std::vector<Grammar> BuildGrammars();
+    static TypeSequence GetAllNouns();
+    static TypeSequence GetAllGenVerbs();
+    static TypeSequence GetAllProperties();
+    static TypeSequence GetAllPreModifiers();
+    static TypeSequence GetAllPostModifiers();
 };
     void DbgPrint(std::string title, TypeSequence types);
 }  // namespace baba_is_auto
@@ -0,0 +1,83 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef BABA_IS_AUTO_CONCURRENT_HASH_SET_HPP
+#define BABA_IS_AUTO_CONCURRENT_HASH_SET_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace baba_is_auto
+{
+//!
+//! \brief ConcurrentHashSet class.
+//!
+//! This class is a set of 64-bit hashes that many threads can insert into
+//! without locks. It is an open addressing table with linear probing, and a
+//! key is claimed by a compare-and-swap on its slot. Keys are never removed.
+//!
+//! The table does not grow while it is shared: Reserve must be called by one
+//! thread, while no other thread uses the set, before the number of keys can
+//! exceed the reserved one.
+//!
+class ConcurrentHashSet
+{
+ public:
+    //! Constructs concurrent hash set that holds \p numKeys keys.
+    //! \param numKeys The number of keys to reserve.
+    explicit ConcurrentHashSet(std::size_t numKeys = 0);
+
+    ConcurrentHashSet(const ConcurrentHashSet&) = delete;
+    ConcurrentHashSet& operator=(const ConcurrentHashSet&) = delete;
+
+    //! Grows the table so that it holds \p numKeys keys. It is not safe to
+    //! call while other threads use the set.
+    //! \param numKeys The number of keys to reserve.
+    void Reserve(std::size_t numKeys);
+
+    //! Removes all keys. It is not safe to call while other threads use the
+    //! set.
+    void Clear();
+
+    //! Inserts \p key into the set. It is safe to call from many threads.
+    //! \param key The key to insert.
+    //! \return The flag indicates that the key was not in the set before.
+    bool Insert(std::uint64_t key);
+
+    //! Checks \p key is in the set.
+    //! \param key The key to find.
+    //! \return The flag indicates that the key is in the set.
+    bool Contains(std::uint64_t key) const;
+
+    //! Gets the number of keys in the set.
+    //! \return The number of keys in the set.
+    std::size_t Size() const;
+
+    //! Gets the number of keys the set holds without growing.
+    //! \return The number of reserved keys.
+    std::size_t GetCapacity() const;
+
+    //! Gets the memory used by the table.
+    //! \return The memory used by the table, in bytes.
+    std::size_t GetMemoryBytes() const;
+
+ private:
+    // The table is kept at most half full, so probes stay short.
+    static constexpr std::size_t MAX_LOAD_DIVISOR = 2;
+
+    // Zero marks an empty slot, so the key zero is kept aside.
+    static constexpr std::uint64_t EMPTY = 0;
+
+    std::unique_ptr<std::atomic<std::uint64_t>[]> m_slots;
+    std::size_t m_numSlots = 0;
+    std::atomic<std::size_t> m_size{ 0 };
+    std::atomic<bool> m_hasZero{ false };
+};
+}  // namespace baba_is_auto
+
+#endif  // BABA_IS_AUTO_CONCURRENT_HASH_SET_HPP
@@ -0,0 +1,62 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef BABA_IS_AUTO_MAPPED_FILE_HPP
+#define BABA_IS_AUTO_MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace baba_is_auto
+{
+//!
+//! \brief MappedFile class.
+//!
+//! This class maps a whole file into memory read-only, so its bytes are
+//! paged in as they are read instead of being copied up front.
+//!
+class MappedFile
+{
+ public:
+    //! Default constructor.
+    MappedFile() = default;
+
+    //! Constructs mapped file with given \p filename.
+    //! \param filename The file name to map.
+    explicit MappedFile(std::string_view filename);
+
+    //! Unmaps the file.
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    //! Maps the file \p filename, unmapping the file mapped before.
+    //! \param filename The file name to map.
+    void Open(std::string_view filename);
+
+    //! Unmaps the file.
+    void Close();
+
+    //! Gets the bytes of the file.
+    //! \return The bytes of the file, or nullptr if it is empty.
+    const std::uint8_t* GetData() const;
+
+    //! Gets the number of bytes of the file.
+    //! \return The number of bytes of the file.
+    std::size_t GetSize() const;
+
+ private:
+    const std::uint8_t* m_data = nullptr;
+    std::size_t m_size = 0;
+};
+}  // namespace baba_is_auto
+
+#endif  // BABA_IS_AUTO_MAPPED_FILE_HPP
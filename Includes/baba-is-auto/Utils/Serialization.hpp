@@ -0,0 +1,172 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef BABA_IS_AUTO_SERIALIZATION_HPP
+#define BABA_IS_AUTO_SERIALIZATION_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace baba_is_auto
+{
+//! A flat blob of bytes.
+using ByteBuffer = std::vector<std::uint8_t>;
+
+//! Appends the bytes of \p value to \p out.
+//! \param out The buffer to append to.
+//! \param value The value to write.
+template <typename T>
+void WriteBytes(ByteBuffer& out, const T& value)
+{
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "Only trivially copyable values can be written as bytes.");
+
+    const std::size_t offset = out.size();
+    out.resize(offset + sizeof(T));
+    std::memcpy(out.data() + offset, &value, sizeof(T));
+}
+
+//! Appends the number of elements and the bytes of \p values to \p out.
+//! \param out The buffer to append to.
+//! \param values The values to write.
+template <typename T>
+void WriteBytes(ByteBuffer& out, const std::vector<T>& values)
+{
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "Only trivially copyable values can be written as bytes.");
+
+    WriteBytes(out, static_cast<std::uint64_t>(values.size()));
+
+    const std::size_t offset = out.size();
+    out.resize(offset + values.size() * sizeof(T));
+    if (!values.empty())
+    {
+        std::memcpy(out.data() + offset, values.data(),
+                    values.size() * sizeof(T));
+    }
+}
+
+//! Reads \p value written by WriteBytes and advances \p in past it.
+//! \param in The pointer to the bytes to read.
+//! \param end The end of the bytes to read.
+//! \param value The value to read into.
+//! \throw std::invalid_argument if the bytes end before the value.
+template <typename T>
+void ReadBytes(const std::uint8_t*& in, const std::uint8_t* end, T& value)
+{
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "Only trivially copyable values can be read as bytes.");
+
+    if (static_cast<std::size_t>(end - in) < sizeof(T))
+    {
+        throw std::invalid_argument("The bytes end before the value.");
+    }
+
+    std::memcpy(&value, in, sizeof(T));
+    in += sizeof(T);
+}
+
+//!
+//! \brief BytesView class.
+//!
+//! This class is a view of the values written by WriteBytes, which are read
+//! in place without copying them. The bytes may not be aligned for T, so
+//! each value is copied out when it is read.
+//!
+template <typename T>
+class BytesView
+{
+ public:
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "Only trivially copyable values can be read as bytes.");
+
+    //! Constructs bytes view of \p size values from \p data.
+    //! \param data The pointer to the bytes of the values.
+    //! \param size The number of values.
+    BytesView(const std::uint8_t* data, std::size_t size)
+        : m_data(data), m_size(size)
+    {
+        // Do nothing
+    }
+
+    //! Gets the number of values.
+    //! \return The number of values.
+    std::size_t size() const
+    {
+        return m_size;
+    }
+
+    //! Gets the value at \p idx.
+    //! \param idx The index of the value, less than size().
+    //! \return The value at \p idx.
+    T operator[](std::size_t idx) const
+    {
+        T value;
+        std::memcpy(&value, m_data + idx * sizeof(T), sizeof(T));
+
+        return value;
+    }
+
+    //! Gets the pointer to the bytes of the values.
+    //! \return The pointer to the bytes of the values.
+    const std::uint8_t* data() const
+    {
+        return m_data;
+    }
+
+ private:
+    const std::uint8_t* m_data = nullptr;
+    std::size_t m_size = 0;
+};
+
+//! Reads the values written by WriteBytes in place and advances \p in past
+//! them.
+//! \param in The pointer to the bytes to read.
+//! \param end The end of the bytes to read.
+//! \return The view of the values.
+//! \throw std::invalid_argument if the bytes end before the values.
+template <typename T>
+BytesView<T> ReadBytesView(const std::uint8_t*& in, const std::uint8_t* end)
+{
+    std::uint64_t size = 0;
+    ReadBytes(in, end, size);
+
+    if (size > static_cast<std::size_t>(end - in) / sizeof(T))
+    {
+        throw std::invalid_argument("The bytes end before the values.");
+    }
+
+    const BytesView<T> view(in, static_cast<std::size_t>(size));
+    in += view.size() * sizeof(T);
+
+    return view;
+}
+
+//! Reads \p values written by WriteBytes and advances \p in past them.
+//! The capacity of \p values is reused, so it does not allocate when
+//! \p values is already large enough.
+//! \param in The pointer to the bytes to read.
+//! \param end The end of the bytes to read.
+//! \param values The values to read into.
+//! \throw std::invalid_argument if the bytes end before the values.
+template <typename T>
+void ReadBytes(const std::uint8_t*& in, const std::uint8_t* end,
+               std::vector<T>& values)
+{
+    const BytesView<T> view = ReadBytesView<T>(in, end);
+
+    values.resize(view.size());
+    if (view.size() != 0)
+    {
+        std::memcpy(values.data(), view.data(), view.size() * sizeof(T));
+    }
+}
+}  // namespace baba_is_auto
+
+#endif  // BABA_IS_AUTO_SERIALIZATION_HPP
@@ -0,0 +1,95 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef BABA_IS_AUTO_THREAD_POOL_HPP
+#define BABA_IS_AUTO_THREAD_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace baba_is_auto
+{
+//!
+//! \brief ThreadPool class.
+//!
+//! This class keeps a fixed number of threads that run one job at a time.
+//! The calling thread takes part in each job as thread 0, so a pool of one
+//! thread runs everything on the caller.
+//!
+class ThreadPool
+{
+ public:
+    //! Constructs thread pool with given \p numThreads.
+    //! \param numThreads The number of threads, including the calling thread.
+    //! Zero means the number of hardware threads.
+    explicit ThreadPool(std::size_t numThreads = 0);
+
+    //! Stops and joins the threads.
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    //! Gets the number of threads, including the calling thread.
+    //! \return The number of threads.
+    std::size_t GetNumThreads() const;
+
+    //! Calls \p func once on each thread and waits for all of them. If any
+    //! call throws, the first exception is rethrown after all calls return.
+    //! \param func The function to call with the index of the thread.
+    void Run(const std::function<void(std::size_t)>& func);
+
+    //! Calls \p func for each index in [0, \p count) and waits for all of
+    //! them. Threads take chunks of \p grain indices until none are left.
+    //! \param count The number of indices.
+    //! \param grain The number of indices taken at a time.
+    //! \param func The function to call with the index of the thread and the
+    //! index.
+    template <typename Func>
+    void ParallelFor(std::size_t count, std::size_t grain, Func&& func)
+    {
+        grain = grain == 0 ? 1 : grain;
+        std::atomic<std::size_t> next{ 0 };
+
+        Run([&](std::size_t threadIdx) {
+            for (std::size_t begin = next.fetch_add(grain); begin < count;
+                 begin = next.fetch_add(grain))
+            {
+                const std::size_t end = begin + grain < count ? begin + grain
+                                                              : count;
+                for (std::size_t idx = begin; idx < end; ++idx)
+                {
+                    func(threadIdx, idx);
+                }
+            }
+        });
+    }
+
+ private:
+    void WorkerLoop(std::size_t threadIdx);
+    void Execute(std::size_t threadIdx);
+
+    std::vector<std::thread> m_workers;
+
+    std::mutex m_mutex;
+    std::condition_variable m_jobReady;
+    std::condition_variable m_jobDone;
+
+    const std::function<void(std::size_t)>* m_job = nullptr;
+    std::size_t m_generation = 0;
+    std::size_t m_numRunning = 0;
+    std::exception_ptr m_exception;
+    bool m_isStopping = false;
+};
+}  // namespace baba_is_auto
+
+#endif  // BABA_IS_AUTO_THREAD_POOL_HPP
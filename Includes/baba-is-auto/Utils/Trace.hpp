@@ -0,0 +1,235 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef BABA_IS_AUTO_TRACE_HPP
+#define BABA_IS_AUTO_TRACE_HPP
+
+#include <baba-is-auto/Enums/TraceEnums.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+//! Traces are compiled in only when BABA_IS_AUTO_ENABLE_TRACE is defined.
+//! Otherwise BABA_TRACE expands to an empty statement and its arguments are
+//! never evaluated, so tracing costs nothing in release builds.
+#ifdef BABA_IS_AUTO_ENABLE_TRACE
+#define BABA_TRACE(level, category, ...)                                    \
+    do                                                                      \
+    {                                                                       \
+        if (::baba_is_auto::Tracer::IsEnabled(level, category))             \
+        {                                                                   \
+            ::baba_is_auto::Tracer::Write(level, category, __VA_ARGS__);    \
+        }                                                                   \
+    } while (false)
+#else
+#define BABA_TRACE(level, category, ...) \
+    do                                   \
+    {                                    \
+    } while (false)
+#endif
+
+namespace baba_is_auto
+{
+#ifdef BABA_IS_AUTO_ENABLE_TRACE
+constexpr bool TRACE_ENABLED = true;
+#else
+constexpr bool TRACE_ENABLED = false;
+#endif
+
+//!
+//! \brief TraceRecord struct.
+//!
+//! This struct represents a single message emitted by the tracer.
+//!
+struct TraceRecord
+{
+    TraceLevel level;
+    TraceCategory category;
+    std::string message;
+};
+
+//! Gets the name of the trace level.
+//! \param level The trace level.
+//! \return The name of the trace level.
+const char* ToString(TraceLevel level);
+
+//! Gets the name of the trace category.
+//! \param category The trace category.
+//! \return The name of the trace category.
+const char* ToString(TraceCategory category);
+
+//!
+//! \brief ITraceSink class.
+//!
+//! This class is an interface of trace sinks. A sink receives every record
+//! that passes the level and category filters of the tracer.
+//!
+class ITraceSink
+{
+ public:
+    //! Default virtual destructor.
+    virtual ~ITraceSink() = default;
+
+    //! Writes a trace record.
+    //! \param record The trace record to write.
+    virtual void Write(const TraceRecord& record) = 0;
+
+    //! Flushes buffered records, if any.
+    virtual void Flush()
+    {
+        // Do nothing
+    }
+};
+
+//!
+//! \brief StreamTraceSink class.
+//!
+//! This class writes trace records to an output stream such as std::clog.
+//!
+class StreamTraceSink final : public ITraceSink
+{
+ public:
+    //! Constructs stream trace sink with given \p stream.
+    //! \param stream The stream to write records to.
+    explicit StreamTraceSink(std::ostream& stream);
+
+    //! Writes a trace record.
+    //! \param record The trace record to write.
+    void Write(const TraceRecord& record) override;
+
+    //! Flushes the stream.
+    void Flush() override;
+
+ private:
+    std::ostream& m_stream;
+};
+
+//!
+//! \brief FileTraceSink class.
+//!
+//! This class writes trace records to a file.
+//!
+class FileTraceSink final : public ITraceSink
+{
+ public:
+    //! Constructs file trace sink with given \p filename.
+    //! \param filename The file name to write records to.
+    explicit FileTraceSink(std::string_view filename);
+
+    //! Writes a trace record.
+    //! \param record The trace record to write.
+    void Write(const TraceRecord& record) override;
+
+    //! Flushes the file.
+    void Flush() override;
+
+ private:
+    std::ofstream m_file;
+};
+
+//!
+//! \brief RingBufferTraceSink class.
+//!
+//! This class keeps the latest records in a fixed-size ring buffer, so that
+//! tracing can stay on in long runs and be inspected after a failure.
+//!
+class RingBufferTraceSink final : public ITraceSink
+{
+ public:
+    //! Constructs ring buffer trace sink with given \p capacity.
+    //! \param capacity The maximum number of records to keep.
+    explicit RingBufferTraceSink(std::size_t capacity);
+
+    //! Writes a trace record, overwriting the oldest one if full.
+    //! \param record The trace record to write.
+    void Write(const TraceRecord& record) override;
+
+    //! Gets the kept records from oldest to newest.
+    //! \return A list of kept records.
+    std::vector<TraceRecord> GetRecords() const;
+
+    //! Clears the kept records.
+    void Clear();
+
+ private:
+    mutable std::mutex m_mutex;
+    std::vector<TraceRecord> m_records;
+    std::size_t m_capacity = 0;
+    std::size_t m_next = 0;
+};
+
+//!
+//! \brief Tracer class.
+//!
+//! This class routes trace records to a sink. Records are filtered by a
+//! minimum level and a set of enabled categories.
+//!
+class Tracer
+{
+ public:
+    //! Sets the sink to receive records. nullptr discards all records.
+    //! \param sink The sink to receive records.
+    static void SetSink(std::shared_ptr<ITraceSink> sink);
+
+    //! Sets the minimum level of records to emit.
+    //! \param level The minimum level.
+    static void SetLevel(TraceLevel level);
+
+    //! Enables or disables a category.
+    //! \param category The category to change.
+    //! \param enabled The flag indicates that the category is enabled.
+    static void EnableCategory(TraceCategory category, bool enabled);
+
+    //! Checks a record of given level and category will be emitted.
+    //! \param level The trace level.
+    //! \param category The trace category.
+    //! \return The flag indicates that the record will be emitted.
+    static bool IsEnabled(TraceLevel level, TraceCategory category)
+    {
+        if constexpr (!TRACE_ENABLED)
+        {
+            return false;
+        }
+
+        return static_cast<int>(level) >=
+                   m_level.load(std::memory_order_relaxed) &&
+               (m_categories.load(std::memory_order_relaxed) &
+                (1u << static_cast<int>(category))) != 0;
+    }
+
+    //! Formats the arguments and writes them as a record.
+    //! \param level The trace level.
+    //! \param category The trace category.
+    //! \param args The values to format.
+    template <typename... Args>
+    static void Write(TraceLevel level, TraceCategory category,
+                      Args&&... args)
+    {
+        std::ostringstream stream;
+        (stream << ... << std::forward<Args>(args));
+        WriteRecord(TraceRecord{ level, category, stream.str() });
+    }
+
+    //! Flushes the current sink.
+    static void Flush();
+
+ private:
+    static void WriteRecord(const TraceRecord& record);
+
+    static std::atomic<int> m_level;
+    static std::atomic<unsigned int> m_categories;
+};
+}  // namespace baba_is_auto
+
+#endif  // BABA_IS_AUTO_TRACE_HPP
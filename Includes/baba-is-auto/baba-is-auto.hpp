@@ -7,16 +7,40 @@
 #ifndef BABA_IS_AUTO_HPP
 #define BABA_IS_AUTO_HPP
 
+#include <baba-is-auto/Agents/BFSSolverAgent.hpp>
+#include <baba-is-auto/Agents/HeuristicSearchAgent.hpp>
+#include <baba-is-auto/Agents/Heuristics.hpp>
 #include <baba-is-auto/Agents/IAgent.hpp>
+#include <baba-is-auto/Agents/MCTSAgent.hpp>
+#include <baba-is-auto/Agents/ObservationBuffer.hpp>
+#include <baba-is-auto/Agents/ObservationEncoder.hpp>
+#include <baba-is-auto/Agents/ParallelBFSSolverAgent.hpp>
 #include <baba-is-auto/Agents/Preprocess.hpp>
 #include <baba-is-auto/Agents/RandomAgent.hpp>
+#include <baba-is-auto/Agents/RolloutEngine.hpp>
+#include <baba-is-auto/Agents/SolverAgent.hpp>
 #include <baba-is-auto/Enums/GameEnums.hpp>
 #include <baba-is-auto/Enums/RuleEnums.hpp>
+#include <baba-is-auto/Enums/SearchEnums.hpp>
+#include <baba-is-auto/Enums/TraceEnums.hpp>
+#include <baba-is-auto/Games/BatchGame.hpp>
+#include <baba-is-auto/Games/Bitboard.hpp>
 #include <baba-is-auto/Games/Game.hpp>
+#include <baba-is-auto/Games/GameProfile.hpp>
+#include <baba-is-auto/Games/LevelCorpus.hpp>
+#include <baba-is-auto/Games/LevelFormat.hpp>
+#include <baba-is-auto/Games/LevelTemplate.hpp>
 #include <baba-is-auto/Games/Map.hpp>
+#include <baba-is-auto/Games/MoveResolver.hpp>
 #include <baba-is-auto/Games/Object.hpp>
+#include <baba-is-auto/Games/StepEvent.hpp>
 #include <baba-is-auto/Rules/Rule.hpp>
 #include <baba-is-auto/Rules/RuleManager.hpp>
+#include <baba-is-auto/Utils/ConcurrentHashSet.hpp>
+#include <baba-is-auto/Utils/MappedFile.hpp>
+#include <baba-is-auto/Utils/Serialization.hpp>
+#include <baba-is-auto/Utils/ThreadPool.hpp>
+#include <baba-is-auto/Utils/Trace.hpp>
 #include <baba-is-auto/baba-is-auto.hpp>
 
 #endif  // BABA_IS_AUTO_HPP
@@ -0,0 +1,121 @@
+#!/usr/bin/env python
+
+"""Converts text maps into binary levels, or packs them into a corpus.
+
+The formats are described in Includes/baba-is-auto/Games/LevelFormat.hpp.
+
+    python convert_maps.py ../Resources/Maps -o maps.babc
+    python convert_maps.py ../Resources/Maps/baba_is_you.txt --levels -o out
+"""
+
+import argparse
+import glob
+import os
+import struct
+
+LEVEL_MAGIC = b"BABL"
+CORPUS_MAGIC = b"BABC"
+FORMAT_VERSION = 1
+
+# Direction::NONE, since text maps do not store directions.
+DIRECTION_NONE = 0
+
+
+def read_text_map(path):
+    with open(path, "r") as map_file:
+        values = [int(token) for token in map_file.read().split()]
+
+    width, height = values[0], values[1]
+    types = values[2:]
+    if len(types) != width * height:
+        raise ValueError("%s: expected %d squares, got %d" %
+                         (path, width * height, len(types)))
+
+    return width, height, types
+
+
+def encode_level(width, height, types):
+    # A text map has exactly one object on each square.
+    num_cells = width * height
+    header = struct.pack("<4sHHHHI", LEVEL_MAGIC, FORMAT_VERSION, 0,
+                         width, height, num_cells)
+    offsets = struct.pack("<%dI" % (num_cells + 1), *range(num_cells + 1))
+    objects = b"".join(struct.pack("<BB", obj_type, DIRECTION_NONE)
+                       for obj_type in types)
+
+    return header + offsets + objects
+
+
+def encode_corpus(names, levels):
+    header = struct.pack("<4sHHII", CORPUS_MAGIC, FORMAT_VERSION, 0,
+                         len(levels), 0)
+
+    offset = len(header) + 32 * len(levels)
+    name_offsets = []
+    encoded_names = [name.encode("utf-8") for name in names]
+    for name in encoded_names:
+        name_offsets.append(offset)
+        offset += len(name)
+
+    # Levels start on 8 bytes, as EncodeCorpus does.
+    level_offsets = []
+    for level in levels:
+        offset = (offset + 7) & ~7
+        level_offsets.append(offset)
+        offset += len(level)
+
+    out = bytearray(header)
+    for idx, level in enumerate(levels):
+        out += struct.pack("<QQQII", level_offsets[idx], len(level),
+                           name_offsets[idx], len(encoded_names[idx]), 0)
+    for name in encoded_names:
+        out += name
+    for idx, level in enumerate(levels):
+        out += b"\0" * (level_offsets[idx] - len(out))
+        out += level
+
+    return bytes(out)
+
+
+def collect_maps(inputs):
+    paths = []
+    for path in inputs:
+        if os.path.isdir(path):
+            paths += sorted(glob.glob(os.path.join(path, "*.txt")))
+        else:
+            paths.append(path)
+
+    return paths
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("inputs", nargs="+",
+                        help="text maps, or directories of them")
+    parser.add_argument("-o", "--output", required=True,
+                        help="the corpus to write, or the directory of the "
+                             "levels with --levels")
+    parser.add_argument("--levels", action="store_true",
+                        help="write a .babl level for each map instead of "
+                             "one corpus")
+    args = parser.parse_args()
+
+    paths = collect_maps(args.inputs)
+    names = [os.path.splitext(os.path.basename(path))[0] for path in paths]
+    levels = [encode_level(*read_text_map(path)) for path in paths]
+
+    if args.levels:
+        if not os.path.isdir(args.output):
+            os.makedirs(args.output)
+        for name, level in zip(names, levels):
+            with open(os.path.join(args.output, name + ".babl"), "wb") as f:
+                f.write(level)
+    else:
+        with open(args.output, "wb") as corpus_file:
+            corpus_file.write(encode_corpus(names, levels))
+
+    print("Converted %d maps." % len(levels))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,130 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <baba-is-auto/Agents/BFSSolverAgent.hpp>
+
+#include <algorithm>
+#include <deque>
+#include <unordered_set>
+
+namespace baba_is_auto
+{
+namespace
+{
+struct Node
+{
+    std::uint32_t parent;
+    Direction action;
+};
+
+constexpr std::uint32_t ROOT = UINT32_MAX;
+}  // namespace
+
+BFSSolverAgent::BFSSolverAgent(SearchLimits limits) : SolverAgent(limits)
+{
+    // Do nothing
+}
+
+SearchStatus BFSSolverAgent::Search(const Game& game,
+                                    std::vector<Direction>& solution,
+                                    SearchStats& stats)
+{
+    if (game.GetPlayState() == PlayState::WON)
+    {
+        return SearchStatus::SOLVED;
+    }
+    if (game.GetPlayState() != PlayState::PLAYING)
+    {
+        return SearchStatus::UNSOLVABLE;
+    }
+
+    Game work = game;
+
+    std::vector<Node> nodes{ Node{ ROOT, Direction::NONE } };
+    std::unordered_set<std::uint64_t> visited{ game.Hash() };
+
+    // The frontier owns the snapshots of its states. Snapshots of expanded
+    // states are reused for new ones, so the number of buffers is the peak
+    // size of the frontier.
+    std::deque<std::pair<std::uint32_t, GameSnapshot>> frontier;
+    std::vector<GameSnapshot> freeSnapshots;
+    std::size_t numSnapshots = 1;
+    frontier.emplace_back(0, work.Snapshot());
+    const std::size_t snapshotSize = frontier.front().second.size();
+
+    const auto UpdateStats = [&]() {
+        stats.statesVisited = visited.size();
+        stats.memoryBytes =
+            nodes.capacity() * sizeof(Node) +
+            visited.bucket_count() * sizeof(void*) +
+            visited.size() * (sizeof(std::uint64_t) + 2 * sizeof(void*)) +
+            numSnapshots * snapshotSize;
+    };
+
+    while (!frontier.empty())
+    {
+        if (IsLimitReached(stats))
+        {
+            UpdateStats();
+            return SearchStatus::LIMIT_REACHED;
+        }
+
+        auto [nodeIdx, snapshot] = std::move(frontier.front());
+        frontier.pop_front();
+        ++stats.nodesExpanded;
+
+        for (const Direction action : SEARCH_ACTIONS)
+        {
+            work.RestoreTrusted(snapshot);
+            work.MovePlayer(action);
+            ++stats.nodesGenerated;
+
+            if (!visited.insert(work.Hash()).second)
+            {
+                continue;
+            }
+
+            nodes.emplace_back(Node{ nodeIdx, action });
+            const auto childIdx = static_cast<std::uint32_t>(nodes.size() - 1);
+
+            if (work.GetPlayState() == PlayState::WON)
+            {
+                for (std::uint32_t idx = childIdx; nodes[idx].parent != ROOT;
+                     idx = nodes[idx].parent)
+                {
+                    solution.emplace_back(nodes[idx].action);
+                }
+                std::reverse(solution.begin(), solution.end());
+
+                UpdateStats();
+                return SearchStatus::SOLVED;
+            }
+
+            if (work.GetPlayState() == PlayState::PLAYING)
+            {
+                GameSnapshot child;
+                if (freeSnapshots.empty())
+                {
+                    ++numSnapshots;
+                }
+                else
+                {
+                    child = std::move(freeSnapshots.back());
+                    freeSnapshots.pop_back();
+                }
+
+                work.Snapshot(child);
+                frontier.emplace_back(childIdx, std::move(child));
+            }
+        }
+
+        freeSnapshots.emplace_back(std::move(snapshot));
+    }
+
+    UpdateStats();
+    return SearchStatus::UNSOLVABLE;
+}
+}  // namespace baba_is_auto
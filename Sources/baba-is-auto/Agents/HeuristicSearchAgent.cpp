@@ -0,0 +1,296 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <baba-is-auto/Agents/HeuristicSearchAgent.hpp>
+#include <baba-is-auto/Utils/Trace.hpp>
+
+#include <algorithm>
+#include <climits>
+#include <queue>
+#include <unordered_map>
+
+namespace baba_is_auto
+{
+namespace
+{
+struct Node
+{
+    std::uint32_t parent;
+    Direction action;
+    int cost;
+    std::uint64_t hash;
+};
+
+struct OpenEntry
+{
+    int estimate;
+    int cost;
+    std::uint32_t node;
+    std::uint32_t snapshot;
+
+    // The most promising entry is on top. Ties go to the deeper one.
+    bool operator<(const OpenEntry& rhs) const
+    {
+        return estimate != rhs.estimate ? estimate > rhs.estimate
+                                        : cost < rhs.cost;
+    }
+};
+
+constexpr std::uint32_t ROOT = UINT32_MAX;
+constexpr int FOUND = -1;
+}  // namespace
+
+HeuristicSearchAgent::HeuristicSearchAgent(
+    SearchAlgorithm algorithm, std::shared_ptr<const IHeuristic> heuristic,
+    SearchLimits limits)
+    : SolverAgent(limits),
+      m_algorithm(algorithm),
+      m_heuristic(heuristic ? std::move(heuristic) : MakeDefaultHeuristic())
+{
+    // Do nothing
+}
+
+SearchAlgorithm HeuristicSearchAgent::GetAlgorithm() const
+{
+    return m_algorithm;
+}
+
+SearchStatus HeuristicSearchAgent::Search(const Game& game,
+                                          std::vector<Direction>& solution,
+                                          SearchStats& stats)
+{
+    if (game.GetPlayState() == PlayState::WON)
+    {
+        return SearchStatus::SOLVED;
+    }
+    if (game.GetPlayState() != PlayState::PLAYING)
+    {
+        return SearchStatus::UNSOLVABLE;
+    }
+
+    return m_algorithm == SearchAlgorithm::A_STAR
+               ? SearchAStar(game, solution, stats)
+               : SearchIDAStar(game, solution, stats);
+}
+
+SearchStatus HeuristicSearchAgent::SearchAStar(const Game& game,
+                                               std::vector<Direction>& solution,
+                                               SearchStats& stats)
+{
+    Game work = game;
+
+    std::vector<Node> nodes{ Node{ ROOT, Direction::NONE, 0, game.Hash() } };
+    std::unordered_map<std::uint64_t, int> bestCosts{ { game.Hash(), 0 } };
+
+    // Snapshots of the open states, indexed by OpenEntry::snapshot.
+    std::vector<GameSnapshot> snapshots(1, work.Snapshot());
+    std::vector<std::uint32_t> freeSnapshots;
+
+    std::priority_queue<OpenEntry> open;
+    open.push(OpenEntry{ m_heuristic->Estimate(work), 0, 0, 0 });
+
+    const auto UpdateStats = [&]() {
+        stats.statesVisited = bestCosts.size();
+        stats.memoryBytes =
+            nodes.capacity() * sizeof(Node) +
+            bestCosts.bucket_count() * sizeof(void*) +
+            bestCosts.size() * (sizeof(std::uint64_t) + sizeof(int) +
+                                2 * sizeof(void*)) +
+            snapshots.size() * snapshots.front().capacity();
+    };
+
+    while (!open.empty())
+    {
+        if (IsLimitReached(stats))
+        {
+            UpdateStats();
+            return SearchStatus::LIMIT_REACHED;
+        }
+
+        const OpenEntry entry = open.top();
+        open.pop();
+
+        // A cheaper way to this state was found after it was pushed.
+        if (bestCosts[nodes[entry.node].hash] < entry.cost)
+        {
+            freeSnapshots.emplace_back(entry.snapshot);
+            continue;
+        }
+
+        work.RestoreTrusted(snapshots[entry.snapshot]);
+        if (work.GetPlayState() == PlayState::WON)
+        {
+            for (std::uint32_t idx = entry.node; nodes[idx].parent != ROOT;
+                 idx = nodes[idx].parent)
+            {
+                solution.emplace_back(nodes[idx].action);
+            }
+            std::reverse(solution.begin(), solution.end());
+
+            UpdateStats();
+            return SearchStatus::SOLVED;
+        }
+
+        ++stats.nodesExpanded;
+
+        for (const Direction action : SEARCH_ACTIONS)
+        {
+            work.RestoreTrusted(snapshots[entry.snapshot]);
+            work.MovePlayer(action);
+            ++stats.nodesGenerated;
+
+            if (work.GetPlayState() == PlayState::LOST)
+            {
+                continue;
+            }
+
+            const int cost = entry.cost + 1;
+            const std::uint64_t hash = work.Hash();
+            const auto [itr, isNew] = bestCosts.try_emplace(hash, cost);
+            if (!isNew)
+            {
+                if (itr->second <= cost)
+                {
+                    continue;
+                }
+                itr->second = cost;
+            }
+
+            nodes.emplace_back(Node{ entry.node, action, cost, hash });
+
+            std::uint32_t snapshotIdx;
+            if (!freeSnapshots.empty())
+            {
+                snapshotIdx = freeSnapshots.back();
+                freeSnapshots.pop_back();
+            }
+            else
+            {
+                snapshotIdx = static_cast<std::uint32_t>(snapshots.size());
+                snapshots.emplace_back();
+            }
+            work.Snapshot(snapshots[snapshotIdx]);
+
+            open.push(OpenEntry{ cost + m_heuristic->Estimate(work), cost,
+                                 static_cast<std::uint32_t>(nodes.size() - 1),
+                                 snapshotIdx });
+        }
+
+        freeSnapshots.emplace_back(entry.snapshot);
+    }
+
+    UpdateStats();
+    return SearchStatus::UNSOLVABLE;
+}
+
+SearchStatus HeuristicSearchAgent::SearchIDAStar(
+    const Game& game, std::vector<Direction>& solution, SearchStats& stats)
+{
+    DepthFirstContext context{
+        game, {}, {}, { game.Hash() }, stats, m_heuristic->Estimate(game),
+        false
+    };
+    context.snapshots.emplace_back(game.Snapshot());
+
+    while (true)
+    {
+        BABA_TRACE(TraceLevel::VERBOSE, TraceCategory::AGENT,
+                   "<IDA*> bound = ", context.bound);
+
+        // The last search left the game at the last state it generated.
+        context.work.RestoreTrusted(context.snapshots.front());
+        const int next = SearchDepthFirst(context, 0);
+
+        stats.memoryBytes = std::max(
+            stats.memoryBytes,
+            context.snapshots.size() * context.snapshots.front().capacity());
+
+        if (next == FOUND)
+        {
+            solution = context.path;
+            return SearchStatus::SOLVED;
+        }
+        if (context.isLimitReached)
+        {
+            return SearchStatus::LIMIT_REACHED;
+        }
+        if (next == INT_MAX)
+        {
+            return SearchStatus::UNSOLVABLE;
+        }
+
+        context.bound = next;
+    }
+}
+
+int HeuristicSearchAgent::SearchDepthFirst(DepthFirstContext& context,
+                                           int cost)
+{
+    Game& work = context.work;
+    const std::size_t depth = context.path.size();
+
+    const int estimate = cost + m_heuristic->Estimate(work);
+    if (estimate > context.bound)
+    {
+        return estimate;
+    }
+    if (work.GetPlayState() == PlayState::WON)
+    {
+        return FOUND;
+    }
+    if (IsLimitReached(context.stats))
+    {
+        context.isLimitReached = true;
+        return INT_MAX;
+    }
+
+    ++context.stats.nodesExpanded;
+    if (context.snapshots.size() <= depth + 1)
+    {
+        context.snapshots.emplace_back();
+    }
+
+    int least = INT_MAX;
+    for (const Direction action : SEARCH_ACTIONS)
+    {
+        work.RestoreTrusted(context.snapshots[depth]);
+        work.MovePlayer(action);
+        ++context.stats.nodesGenerated;
+
+        if (work.GetPlayState() == PlayState::LOST)
+        {
+            continue;
+        }
+
+        // Going back to a state on the path never makes it shorter.
+        const std::uint64_t hash = work.Hash();
+        if (!context.onPath.insert(hash).second)
+        {
+            continue;
+        }
+
+        work.Snapshot(context.snapshots[depth + 1]);
+        context.path.emplace_back(action);
+
+        const int result = SearchDepthFirst(context, cost + 1);
+        if (result == FOUND)
+        {
+            return FOUND;
+        }
+
+        context.path.pop_back();
+        context.onPath.erase(hash);
+
+        if (context.isLimitReached)
+        {
+            return INT_MAX;
+        }
+        least = std::min(least, result);
+    }
+
+    return least;
+}
+}  // namespace baba_is_auto
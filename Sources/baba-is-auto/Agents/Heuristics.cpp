@@ -0,0 +1,191 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <baba-is-auto/Agents/Heuristics.hpp>
+
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
+
+namespace baba_is_auto
+{
+namespace
+{
+struct Position
+{
+    int x;
+    int y;
+};
+
+int GetDistance(const Position& lhs, const Position& rhs)
+{
+    return std::abs(lhs.x - rhs.x) + std::abs(lhs.y - rhs.y);
+}
+
+std::vector<Position> ToPositions(const Bitboard& board, std::size_t width)
+{
+    std::vector<Position> positions;
+    board.ForEach([&](std::size_t cell) {
+        positions.emplace_back(Position{ static_cast<int>(cell % width),
+                                         static_cast<int>(cell / width) });
+    });
+
+    return positions;
+}
+
+bool HasRuleOf(const RuleManager& ruleManager, ObjectType property)
+{
+    for (auto& rule : ruleManager.GetRules(property))
+    {
+        if (rule.GetOperator() == ObjectType::IS &&
+            rule.GetPredicate() == property && IsNounType(rule.GetSubject()))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+}  // namespace
+
+int ZeroHeuristic::Estimate([[maybe_unused]] const Game& game) const
+{
+    return 0;
+}
+
+int YouToWinDistanceHeuristic::Estimate(const Game& game) const
+{
+    const Map& map = game.GetMap();
+    const RuleManager& ruleManager = game.GetRuleManager();
+
+    const auto yous = ToPositions(
+        ruleManager.GetPropertyBitboard(map, ObjectType::YOU), map.GetWidth());
+    const auto wins = ToPositions(
+        ruleManager.GetPropertyBitboard(map, ObjectType::WIN), map.GetWidth());
+
+    int best = INT_MAX;
+    for (auto& you : yous)
+    {
+        for (auto& win : wins)
+        {
+            best = std::min(best, GetDistance(you, win));
+        }
+    }
+
+    return best == INT_MAX ? 0 : best;
+}
+
+int RuleTextDistanceHeuristic::Estimate(const Game& game) const
+{
+    const Map& map = game.GetMap();
+    const RuleManager& ruleManager = game.GetRuleManager();
+    const auto width = static_cast<int>(map.GetWidth());
+    const auto height = static_cast<int>(map.GetHeight());
+
+    const auto HasText = [&](int x, int y, auto&& pred) {
+        if (x < 0 || x >= width || y < 0 || y >= height)
+        {
+            return false;
+        }
+        for (const ObjectSlot slot : map.GetSlots(x, y))
+        {
+            if (pred(map.GetType(slot)))
+            {
+                return true;
+            }
+        }
+        return false;
+    };
+    const auto IsIS = [](ObjectType type) { return type == ObjectType::IS; };
+    const auto IsNoun = [](ObjectType type) { return IsNounType(type); };
+
+    // The squares where a property text would complete "NOUN IS _".
+    std::vector<Position> slots;
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < width; ++x)
+        {
+            if (!HasText(x, y, IsIS))
+            {
+                continue;
+            }
+            if (x + 1 < width && HasText(x - 1, y, IsNoun))
+            {
+                slots.emplace_back(Position{ x + 1, y });
+            }
+            if (y + 1 < height && HasText(x, y - 1, IsNoun))
+            {
+                slots.emplace_back(Position{ x, y + 1 });
+            }
+        }
+    }
+
+    int estimate = 0;
+    for (const ObjectType property : { ObjectType::YOU, ObjectType::WIN })
+    {
+        if (slots.empty() || HasRuleOf(ruleManager, property))
+        {
+            continue;
+        }
+
+        int best = INT_MAX;
+        for (int y = 0; y < height; ++y)
+        {
+            for (int x = 0; x < width; ++x)
+            {
+                if (!HasText(x, y, [&](ObjectType type) {
+                        return type == property;
+                    }))
+                {
+                    continue;
+                }
+                for (auto& slot : slots)
+                {
+                    best = std::min(best, GetDistance(Position{ x, y }, slot));
+                }
+            }
+        }
+
+        if (best != INT_MAX)
+        {
+            estimate = std::max(estimate, best);
+        }
+    }
+
+    return estimate;
+}
+
+MaxHeuristic::MaxHeuristic(
+    std::vector<std::shared_ptr<const IHeuristic>> heuristics)
+    : m_heuristics(std::move(heuristics))
+{
+    // Do nothing
+}
+
+int MaxHeuristic::Estimate(const Game& game) const
+{
+    int estimate = 0;
+    for (auto& heuristic : m_heuristics)
+    {
+        estimate = std::max(estimate, heuristic->Estimate(game));
+    }
+
+    return estimate;
+}
+
+std::shared_ptr<const IHeuristic> MakeDefaultHeuristic()
+{
+    return std::make_shared<ZeroHeuristic>();
+}
+
+std::shared_ptr<const IHeuristic> MakeGuidedHeuristic()
+{
+    return std::make_shared<MaxHeuristic>(
+        std::vector<std::shared_ptr<const IHeuristic>>{
+            std::make_shared<YouToWinDistanceHeuristic>(),
+            std::make_shared<RuleTextDistanceHeuristic>() });
+}
+}  // namespace baba_is_auto
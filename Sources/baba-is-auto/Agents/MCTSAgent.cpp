@@ -0,0 +1,415 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <baba-is-auto/Agents/MCTSAgent.hpp>
+#include <baba-is-auto/Utils/Trace.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <stdexcept>
+
+namespace baba_is_auto
+{
+namespace
+{
+// Values are summed as fixed-point integers, so that threads can add them
+// with one atomic operation.
+constexpr double VALUE_SCALE = 1 << 20;
+}  // namespace
+
+struct MCTSAgent::Node
+{
+    Node(Node* parentNode, std::size_t action, PlayState playState)
+        : parent(parentNode),
+          actionIdx(action),
+          isTerminal(playState != PlayState::PLAYING),
+          terminalValue(playState == PlayState::WON ? 1.0 : 0.0)
+    {
+        for (auto& child : children)
+        {
+            child.store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    ~Node()
+    {
+        // Delete the subtree without recursion, since a tree can be as deep
+        // as the number of iterations.
+        std::vector<Node*> stack;
+        const auto PushChildren = [&stack](Node& node) {
+            for (auto& child : node.children)
+            {
+                if (Node* ptr = child.exchange(nullptr); ptr != nullptr)
+                {
+                    stack.emplace_back(ptr);
+                }
+            }
+        };
+
+        PushChildren(*this);
+        while (!stack.empty())
+        {
+            Node* node = stack.back();
+            stack.pop_back();
+            PushChildren(*node);
+            delete node;
+        }
+    }
+
+    Node* parent;
+    std::size_t actionIdx;
+    bool isTerminal;
+    double terminalValue;
+
+    std::array<std::atomic<Node*>, SEARCH_ACTIONS.size()> children;
+    std::atomic<std::int64_t> visits{ 0 };
+    std::atomic<std::int64_t> value{ 0 };
+};
+
+struct MCTSAgent::ThreadContext
+{
+    std::mt19937_64 rng;
+    std::unique_ptr<Game> work;
+
+    std::unique_ptr<Node> root;
+
+    std::size_t iterations = 0;
+    std::size_t rollouts = 0;
+    std::size_t rolloutSteps = 0;
+    std::size_t treeNodes = 0;
+};
+
+MCTSAgent::MCTSAgent(MCTSOptions options,
+                     std::shared_ptr<const IHeuristic> heuristic)
+    : m_options(options),
+      m_heuristic(std::move(heuristic)),
+      m_pool(options.numThreads)
+{
+    if (m_options.maxIterations == 0 && m_options.maxSeconds <= 0.0)
+    {
+        throw std::invalid_argument(
+            "MCTSAgent - Either maxIterations or maxSeconds must be set.");
+    }
+
+    m_contexts.resize(m_pool.GetNumThreads());
+    for (std::size_t i = 0; i < m_contexts.size(); ++i)
+    {
+        m_contexts[i].rng.seed(m_options.seed + i);
+    }
+}
+
+MCTSAgent::~MCTSAgent() = default;
+
+Direction MCTSAgent::Search(const Game& game)
+{
+    m_rootVisits.fill(0);
+    m_rootValues.fill(0.0);
+    m_stats = MCTSStats();
+    m_stats.numThreads = m_contexts.size();
+
+    if (game.GetPlayState() != PlayState::PLAYING)
+    {
+        return Direction::NONE;
+    }
+
+    const bool isTreeParallel =
+        m_options.parallelism == MCTSParallelism::TREE;
+    const int virtualLoss = isTreeParallel ? m_options.virtualLoss : 0;
+    const GameSnapshot rootSnapshot = game.Snapshot();
+
+    for (auto& context : m_contexts)
+    {
+        if (context.work)
+        {
+            *context.work = game;
+        }
+        else
+        {
+            context.work = std::make_unique<Game>(game);
+        }
+
+        context.root.reset();
+        context.iterations = 0;
+        context.rollouts = 0;
+        context.rolloutSteps = 0;
+        context.treeNodes = 0;
+    }
+
+    std::unique_ptr<Node> sharedRoot;
+    if (isTreeParallel)
+    {
+        sharedRoot = std::make_unique<Node>(nullptr, 0, PlayState::PLAYING);
+        ++m_contexts.front().treeNodes;
+    }
+    else
+    {
+        for (auto& context : m_contexts)
+        {
+            context.root =
+                std::make_unique<Node>(nullptr, 0, PlayState::PLAYING);
+            ++context.treeNodes;
+        }
+    }
+
+    m_numStarted.store(0, std::memory_order_relaxed);
+    m_startTime = std::chrono::steady_clock::now();
+
+    m_pool.Run([&](std::size_t threadIdx) {
+        ThreadContext& context = m_contexts[threadIdx];
+        RunIterations(isTreeParallel ? *sharedRoot : *context.root,
+                      rootSnapshot, context, virtualLoss);
+    });
+
+    m_stats.elapsedSeconds = std::chrono::duration<double>(
+                                 std::chrono::steady_clock::now() - m_startTime)
+                                 .count();
+
+    // Sum the visits and the values of the roots. With tree parallelism
+    // there is only one root.
+    std::array<double, SEARCH_ACTIONS.size()> valueSums{};
+    const auto AddRoot = [&](const Node& root) {
+        for (std::size_t i = 0; i < SEARCH_ACTIONS.size(); ++i)
+        {
+            if (const Node* child =
+                    root.children[i].load(std::memory_order_relaxed))
+            {
+                m_rootVisits[i] += static_cast<std::size_t>(
+                    child->visits.load(std::memory_order_relaxed));
+                valueSums[i] += static_cast<double>(child->value.load(
+                                    std::memory_order_relaxed)) /
+                                VALUE_SCALE;
+            }
+        }
+    };
+
+    if (isTreeParallel)
+    {
+        AddRoot(*sharedRoot);
+    }
+    for (auto& context : m_contexts)
+    {
+        if (context.root)
+        {
+            AddRoot(*context.root);
+            context.root.reset();
+        }
+
+        m_stats.iterations += context.iterations;
+        m_stats.rollouts += context.rollouts;
+        m_stats.rolloutSteps += context.rolloutSteps;
+        m_stats.treeNodes += context.treeNodes;
+    }
+
+    std::size_t bestIdx = 0;
+    for (std::size_t i = 0; i < SEARCH_ACTIONS.size(); ++i)
+    {
+        if (m_rootVisits[i] > 0)
+        {
+            m_rootValues[i] =
+                valueSums[i] / static_cast<double>(m_rootVisits[i]);
+        }
+
+        if (m_rootVisits[i] > m_rootVisits[bestIdx] ||
+            (m_rootVisits[i] == m_rootVisits[bestIdx] &&
+             m_rootValues[i] > m_rootValues[bestIdx]))
+        {
+            bestIdx = i;
+        }
+    }
+
+    BABA_TRACE(TraceLevel::INFO, TraceCategory::AGENT,
+               "<MCTS> (iterations, nodes, rollouts/s, action) = ",
+               m_stats.iterations, " ", m_stats.treeNodes, " ",
+               m_stats.GetRolloutsPerSecond(), " ",
+               static_cast<int>(SEARCH_ACTIONS[bestIdx]));
+
+    return SEARCH_ACTIONS[bestIdx];
+}
+
+Direction MCTSAgent::GetAction(const Game& state)
+{
+    return Search(state);
+}
+
+const std::array<std::size_t, SEARCH_ACTIONS.size()>&
+MCTSAgent::GetRootVisits() const
+{
+    return m_rootVisits;
+}
+
+const std::array<double, SEARCH_ACTIONS.size()>& MCTSAgent::GetRootValues()
+    const
+{
+    return m_rootValues;
+}
+
+const MCTSStats& MCTSAgent::GetStats() const
+{
+    return m_stats;
+}
+
+const MCTSOptions& MCTSAgent::GetOptions() const
+{
+    return m_options;
+}
+
+void MCTSAgent::RunIterations(Node& root, const GameSnapshot& rootSnapshot,
+                              ThreadContext& context, int virtualLoss)
+{
+    Game& work = *context.work;
+
+    while (true)
+    {
+        if (m_options.maxIterations != 0 &&
+            m_numStarted.fetch_add(1, std::memory_order_relaxed) >=
+                m_options.maxIterations)
+        {
+            break;
+        }
+        if (m_options.maxSeconds > 0.0 &&
+            std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                          m_startTime)
+                    .count() >= m_options.maxSeconds)
+        {
+            break;
+        }
+
+        ++context.iterations;
+        work.RestoreTrusted(rootSnapshot);
+
+        // Selection and expansion.
+        Node* node = &root;
+        node->visits.fetch_add(virtualLoss, std::memory_order_relaxed);
+
+        while (!node->isTerminal)
+        {
+            if (Node* child = ExpandChild(*node, work, virtualLoss, context))
+            {
+                node = child;
+                break;
+            }
+
+            node = SelectChild(*node);
+            node->visits.fetch_add(virtualLoss, std::memory_order_relaxed);
+            work.MovePlayer(SEARCH_ACTIONS[node->actionIdx]);
+        }
+
+        // Simulation.
+        double value = node->terminalValue;
+        if (!node->isTerminal)
+        {
+            value = Rollout(work, context);
+            ++context.rollouts;
+        }
+
+        // Backpropagation, which also takes back the virtual losses.
+        const auto scaledValue = static_cast<std::int64_t>(value * VALUE_SCALE);
+        for (; node != nullptr; node = node->parent)
+        {
+            node->visits.fetch_add(1 - virtualLoss, std::memory_order_relaxed);
+            node->value.fetch_add(scaledValue, std::memory_order_relaxed);
+        }
+    }
+}
+
+MCTSAgent::Node* MCTSAgent::SelectChild(Node& node) const
+{
+    const auto parentVisits = static_cast<double>(
+        std::max<std::int64_t>(node.visits.load(std::memory_order_relaxed), 1));
+    const double logParentVisits = std::log(parentVisits);
+
+    Node* best = nullptr;
+    double bestScore = -std::numeric_limits<double>::infinity();
+
+    for (auto& slot : node.children)
+    {
+        Node* child = slot.load(std::memory_order_acquire);
+        const std::int64_t visits = child->visits.load(std::memory_order_relaxed);
+
+        // Another thread may have added the child and not visited it yet.
+        if (visits <= 0)
+        {
+            return child;
+        }
+
+        const double mean =
+            static_cast<double>(child->value.load(std::memory_order_relaxed)) /
+            VALUE_SCALE / static_cast<double>(visits);
+        const double score =
+            mean + m_options.explorationConstant *
+                       std::sqrt(logParentVisits / static_cast<double>(visits));
+
+        if (score > bestScore)
+        {
+            best = child;
+            bestScore = score;
+        }
+    }
+
+    return best;
+}
+
+MCTSAgent::Node* MCTSAgent::ExpandChild(Node& node, Game& work,
+                                        int virtualLoss,
+                                        ThreadContext& context) const
+{
+    for (std::size_t i = 0; i < SEARCH_ACTIONS.size(); ++i)
+    {
+        if (node.children[i].load(std::memory_order_acquire) != nullptr)
+        {
+            continue;
+        }
+
+        work.MovePlayer(SEARCH_ACTIONS[i]);
+
+        auto child = std::make_unique<Node>(&node, i, work.GetPlayState());
+        child->visits.store(virtualLoss, std::memory_order_relaxed);
+
+        Node* expected = nullptr;
+        if (node.children[i].compare_exchange_strong(
+                expected, child.get(), std::memory_order_acq_rel))
+        {
+            ++context.treeNodes;
+            return child.release();
+        }
+
+        // Another thread has added the same child first. The game is in the
+        // same state either way, so go on from that child.
+        expected->visits.fetch_add(virtualLoss, std::memory_order_relaxed);
+        return expected;
+    }
+
+    return nullptr;
+}
+
+double MCTSAgent::Rollout(Game& work, ThreadContext& context) const
+{
+    std::uniform_int_distribution<std::size_t> actionDist(
+        0, SEARCH_ACTIONS.size() - 1);
+
+    for (std::size_t depth = 0; depth < m_options.rolloutDepth &&
+                                work.GetPlayState() == PlayState::PLAYING;
+         ++depth)
+    {
+        work.MovePlayer(SEARCH_ACTIONS[actionDist(context.rng)]);
+        ++context.rolloutSteps;
+    }
+
+    switch (work.GetPlayState())
+    {
+        case PlayState::WON:
+            return 1.0;
+        case PlayState::PLAYING:
+            return m_heuristic
+                       ? 0.5 / (1.0 + std::max(m_heuristic->Estimate(work), 0))
+                       : 0.0;
+        default:
+            return 0.0;
+    }
+}
+}  // namespace baba_is_auto
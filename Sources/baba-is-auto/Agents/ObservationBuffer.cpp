@@ -0,0 +1,93 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <baba-is-auto/Agents/ObservationBuffer.hpp>
+
+#include <stdexcept>
+
+namespace baba_is_auto
+{
+ObservationBuffer::ObservationBuffer(
+    const Game& game, std::shared_ptr<const ObservationEncoder> encoder)
+    : ObservationBuffer(game.GetMap().GetWidth(), game.GetMap().GetHeight(),
+                        std::move(encoder))
+{
+    Update(game);
+}
+
+ObservationBuffer::ObservationBuffer(
+    std::size_t width, std::size_t height,
+    std::shared_ptr<const ObservationEncoder> encoder)
+    : m_encoder(std::move(encoder)), m_width(width), m_height(height)
+{
+    if (!m_encoder)
+    {
+        // The default encoder is a static, so it is not owned.
+        m_encoder = std::shared_ptr<const ObservationEncoder>(
+            std::shared_ptr<const ObservationEncoder>(),
+            &ObservationEncoder::GetDefault());
+    }
+
+    m_data.resize(m_encoder->GetNumChannels() * width * height, 0.0f);
+}
+
+void ObservationBuffer::Update(const Game& game)
+{
+    CheckSize(game);
+    m_encoder->Encode(game, m_data.data());
+}
+
+void ObservationBuffer::UpdateChanges(const Game& game)
+{
+    CheckSize(game);
+    m_encoder->EncodeChanges(game, m_data.data());
+}
+
+const ObservationEncoder& ObservationBuffer::GetEncoder() const
+{
+    return *m_encoder;
+}
+
+std::size_t ObservationBuffer::GetNumChannels() const
+{
+    return m_encoder->GetNumChannels();
+}
+
+std::size_t ObservationBuffer::GetHeight() const
+{
+    return m_height;
+}
+
+std::size_t ObservationBuffer::GetWidth() const
+{
+    return m_width;
+}
+
+std::size_t ObservationBuffer::GetSize() const
+{
+    return m_data.size();
+}
+
+float* ObservationBuffer::GetData()
+{
+    return m_data.data();
+}
+
+const float* ObservationBuffer::GetData() const
+{
+    return m_data.data();
+}
+
+void ObservationBuffer::CheckSize(const Game& game) const
+{
+    if (game.GetMap().GetWidth() != m_width ||
+        game.GetMap().GetHeight() != m_height)
+    {
+        throw std::invalid_argument(
+            "ObservationBuffer - The size of the map does not match.");
+    }
+}
+}  // namespace baba_is_auto
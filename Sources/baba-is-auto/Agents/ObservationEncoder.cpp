@@ -0,0 +1,239 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <baba-is-auto/Agents/ObservationEncoder.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace baba_is_auto
+{
+namespace
+{
+bool IsSectionType(ObjectType type)
+{
+    return type == ObjectType::NOUN_TYPE || type == ObjectType::OP_TYPE ||
+           type == ObjectType::PROPERTY_TYPE ||
+           type == ObjectType::ICON_TYPE || type == ObjectType::GRAMMAR_TYPE;
+}
+}  // namespace
+
+ObservationEncoder::ObservationEncoder(EncoderSpec spec)
+    : m_spec(std::move(spec))
+{
+    m_typeChannels.fill(NO_CHANNEL);
+    m_propertyChannels.fill(NO_CHANNEL);
+
+    for (std::size_t channel = 0; channel < m_spec.typeChannels.size();
+         ++channel)
+    {
+        for (const ObjectType type : m_spec.typeChannels[channel])
+        {
+            auto& entry = m_typeChannels[static_cast<std::size_t>(type)];
+            if (entry != NO_CHANNEL)
+            {
+                throw std::invalid_argument(
+                    "ObservationEncoder - An object type has two channels.");
+            }
+
+            entry = static_cast<std::int16_t>(channel);
+        }
+    }
+
+    m_numChannels = m_spec.typeChannels.size();
+    if (m_spec.hasTextPlane)
+    {
+        m_textChannel = static_cast<int>(m_numChannels++);
+    }
+    if (m_spec.hasRulePlane)
+    {
+        m_ruleChannel = static_cast<int>(m_numChannels++);
+    }
+
+    for (const ObjectType property : m_spec.propertyPlanes)
+    {
+        if (!IsPropertyType(property))
+        {
+            throw std::invalid_argument(
+                "ObservationEncoder - A property plane needs a property.");
+        }
+
+        const PropertyMask bit = ToPropertyBit(property);
+        if (m_propertyMask & bit)
+        {
+            throw std::invalid_argument(
+                "ObservationEncoder - A property has two planes.");
+        }
+
+        m_propertyMask |= bit;
+        m_propertyChannels[CountTrailingZeros(bit)] =
+            static_cast<std::int16_t>(m_numChannels++);
+    }
+}
+
+EncoderSpec ObservationEncoder::MakeDefaultSpec()
+{
+    EncoderSpec spec;
+    spec.typeChannels = {
+        { ObjectType::BABA },      { ObjectType::IS },
+        { ObjectType::YOU },       { ObjectType::ICON_EMPTY },
+        { ObjectType::FLAG },      { ObjectType::WIN },
+        { ObjectType::ICON_WALL }, { ObjectType::ICON_ROCK },
+        { ObjectType::ICON_BABA }, { ObjectType::ICON_FLAG },
+        { ObjectType::WALL },      { ObjectType::STOP },
+        { ObjectType::ROCK },      { ObjectType::PUSH },
+    };
+    spec.hasTextPlane = true;
+    spec.hasRulePlane = true;
+
+    return spec;
+}
+
+EncoderSpec ObservationEncoder::MakeFullSpec(bool hasPropertyPlanes)
+{
+    EncoderSpec spec;
+
+    const auto last = static_cast<int>(ObjectType::PostMP);
+    for (int val = 0; val <= last; ++val)
+    {
+        const auto type = static_cast<ObjectType>(val);
+        if (IsSectionType(type))
+        {
+            continue;
+        }
+
+        spec.typeChannels.emplace_back(TypeSequence{ type });
+        if (hasPropertyPlanes && IsPropertyType(type))
+        {
+            spec.propertyPlanes.emplace_back(type);
+        }
+    }
+
+    spec.hasTextPlane = true;
+    spec.hasRulePlane = true;
+
+    return spec;
+}
+
+const ObservationEncoder& ObservationEncoder::GetDefault()
+{
+    static const ObservationEncoder encoder(MakeDefaultSpec());
+    return encoder;
+}
+
+const EncoderSpec& ObservationEncoder::GetSpec() const
+{
+    return m_spec;
+}
+
+std::size_t ObservationEncoder::GetNumChannels() const
+{
+    return m_numChannels;
+}
+
+int ObservationEncoder::GetChannel(ObjectType type) const
+{
+    return m_typeChannels[static_cast<std::size_t>(type)];
+}
+
+std::size_t ObservationEncoder::GetTensorSize(const Game& game) const
+{
+    return m_numChannels * game.GetMap().GetWidth() *
+           game.GetMap().GetHeight();
+}
+
+std::vector<float> ObservationEncoder::Encode(const Game& game) const
+{
+    std::vector<float> tensor(GetTensorSize(game));
+    Encode(game, tensor.data());
+
+    return tensor;
+}
+
+void ObservationEncoder::Encode(const Game& game, float* tensor) const
+{
+    const std::size_t width = game.GetMap().GetWidth();
+    const std::size_t height = game.GetMap().GetHeight();
+
+    std::fill(tensor, tensor + m_numChannels * width * height, 0.0f);
+
+    for (std::size_t y = 0; y < height; ++y)
+    {
+        for (std::size_t x = 0; x < width; ++x)
+        {
+            EncodeCell(game, x, y, tensor);
+        }
+    }
+}
+
+void ObservationEncoder::EncodeChanges(const Game& game, float* tensor) const
+{
+    const Map& map = game.GetMap();
+
+    if (map.AreAllCellsDirty() ||
+        (m_propertyMask != 0 && game.GetRuleManager().HasChangedProperties()))
+    {
+        Encode(game, tensor);
+        return;
+    }
+
+    const std::size_t width = map.GetWidth();
+    const std::size_t planeSize = width * map.GetHeight();
+
+    for (const std::uint32_t cell : map.GetDirtyCells())
+    {
+        for (std::size_t channel = 0; channel < m_numChannels; ++channel)
+        {
+            tensor[channel * planeSize + cell] = 0.0f;
+        }
+
+        EncodeCell(game, cell % width, cell / width, tensor);
+    }
+}
+
+void ObservationEncoder::EncodeCell(const Game& game, std::size_t x,
+                                    std::size_t y, float* tensor) const
+{
+    const Map& map = game.GetMap();
+    const RuleManager& ruleManager = game.GetRuleManager();
+    const std::size_t width = map.GetWidth();
+    const std::size_t planeSize = width * map.GetHeight();
+
+    float* cell = tensor + y * width + x;
+    bool hasText = false;
+
+    for (const ObjectSlot slot : map.GetSlots(x, y))
+    {
+        const ObjectType type = map.GetType(slot);
+
+        const int channel = m_typeChannels[static_cast<std::size_t>(type)];
+        if (channel != NO_CHANNEL)
+        {
+            cell[channel * planeSize] = 1.0f;
+        }
+
+        hasText = hasText || IsTextType(type);
+
+        PropertyMask properties =
+            ruleManager.GetProperties(type) & m_propertyMask;
+        while (properties != 0)
+        {
+            cell[m_propertyChannels[CountTrailingZeros(properties)] *
+                 planeSize] = 1.0f;
+            properties &= properties - 1;
+        }
+    }
+
+    if (m_textChannel != NO_CHANNEL && hasText)
+    {
+        cell[m_textChannel * planeSize] = 1.0f;
+    }
+    if (m_ruleChannel != NO_CHANNEL && map.IsRule(x, y))
+    {
+        cell[m_ruleChannel * planeSize] = 1.0f;
+    }
+}
+}  // namespace baba_is_auto
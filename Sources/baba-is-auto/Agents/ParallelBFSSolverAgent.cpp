@@ -0,0 +1,255 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <baba-is-auto/Agents/ParallelBFSSolverAgent.hpp>
+#include <baba-is-auto/Utils/ConcurrentHashSet.hpp>
+
+#include <algorithm>
+#include <atomic>
+
+namespace baba_is_auto
+{
+namespace
+{
+struct Node
+{
+    std::uint32_t parent;
+    Direction action;
+};
+
+constexpr std::uint32_t ROOT = UINT32_MAX;
+constexpr std::size_t NO_NODE = SIZE_MAX;
+
+// The number of states a thread takes from the frontier at a time.
+constexpr std::size_t CHUNK_SIZE = 16;
+
+// The states that a thread found while expanding its share of a depth.
+struct ThreadBuffer
+{
+    explicit ThreadBuffer(const Game& game) : work(game)
+    {
+        // Do nothing
+    }
+
+    Game work;
+
+    // The new states, linked to the global indices of their parents.
+    std::vector<Node> nodes;
+
+    // The snapshots of the new states that are still playing, and the
+    // indices of those states in nodes.
+    std::vector<GameSnapshot> snapshots;
+    std::vector<std::uint32_t> snapshotNodes;
+
+    std::vector<GameSnapshot> freeSnapshots;
+    std::size_t numSnapshots = 0;
+
+    std::size_t nodesExpanded = 0;
+    std::size_t nodesGenerated = 0;
+    std::size_t wonNode = NO_NODE;
+};
+}  // namespace
+
+ParallelBFSSolverAgent::ParallelBFSSolverAgent(std::size_t numThreads,
+                                               SearchLimits limits)
+    : SolverAgent(limits), m_pool(numThreads)
+{
+    // Do nothing
+}
+
+std::size_t ParallelBFSSolverAgent::GetNumThreads() const
+{
+    return m_pool.GetNumThreads();
+}
+
+SearchStatus ParallelBFSSolverAgent::Search(const Game& game,
+                                            std::vector<Direction>& solution,
+                                            SearchStats& stats)
+{
+    if (game.GetPlayState() == PlayState::WON)
+    {
+        return SearchStatus::SOLVED;
+    }
+    if (game.GetPlayState() != PlayState::PLAYING)
+    {
+        return SearchStatus::UNSOLVABLE;
+    }
+
+    std::vector<ThreadBuffer> buffers(m_pool.GetNumThreads(),
+                                      ThreadBuffer(game));
+
+    std::vector<Node> nodes{ Node{ ROOT, Direction::NONE } };
+    ConcurrentHashSet visited(1024);
+    visited.Insert(game.Hash());
+
+    std::vector<std::uint32_t> frontierNodes{ 0 };
+    std::vector<GameSnapshot> frontier{ game.Snapshot() };
+    const std::size_t snapshotSize = frontier.front().size();
+
+    std::vector<std::uint32_t> nextFrontierNodes;
+    std::vector<GameSnapshot> nextFrontier;
+
+    const auto UpdateStats = [&]() {
+        std::size_t numSnapshots = 1;
+        for (const auto& buffer : buffers)
+        {
+            numSnapshots += buffer.numSnapshots;
+        }
+
+        stats.statesVisited = visited.Size();
+        stats.memoryBytes = nodes.capacity() * sizeof(Node) +
+                            visited.GetMemoryBytes() +
+                            numSnapshots * snapshotSize;
+    };
+
+    while (!frontier.empty())
+    {
+        if (IsLimitReached(stats))
+        {
+            UpdateStats();
+            return SearchStatus::LIMIT_REACHED;
+        }
+
+        // Each state of this depth adds at most one new state per action, so
+        // the set never has to grow while the threads share it.
+        visited.Reserve(visited.Size() +
+                        frontier.size() * SEARCH_ACTIONS.size());
+
+        std::atomic<std::size_t> numStarted{ stats.nodesExpanded };
+        std::atomic<bool> isStopping{ false };
+        std::atomic<bool> isLimitReached{ false };
+
+        m_pool.ParallelFor(
+            frontier.size(), CHUNK_SIZE,
+            [&](std::size_t threadIdx, std::size_t idx) {
+                if (isStopping.load(std::memory_order_relaxed))
+                {
+                    return;
+                }
+
+                SearchStats progress;
+                progress.nodesExpanded =
+                    numStarted.fetch_add(1, std::memory_order_relaxed);
+                if (IsLimitReached(progress))
+                {
+                    isLimitReached.store(true, std::memory_order_relaxed);
+                    isStopping.store(true, std::memory_order_relaxed);
+                    return;
+                }
+
+                ThreadBuffer& buffer = buffers[threadIdx];
+                Game& work = buffer.work;
+                ++buffer.nodesExpanded;
+
+                for (const Direction action : SEARCH_ACTIONS)
+                {
+                    work.RestoreTrusted(frontier[idx]);
+                    work.MovePlayer(action);
+                    ++buffer.nodesGenerated;
+
+                    if (!visited.Insert(work.Hash()))
+                    {
+                        continue;
+                    }
+
+                    buffer.nodes.emplace_back(Node{ frontierNodes[idx], action });
+                    const auto nodeIdx =
+                        static_cast<std::uint32_t>(buffer.nodes.size() - 1);
+
+                    if (work.GetPlayState() == PlayState::WON)
+                    {
+                        if (buffer.wonNode == NO_NODE)
+                        {
+                            buffer.wonNode = nodeIdx;
+                        }
+                        isStopping.store(true, std::memory_order_relaxed);
+                    }
+                    else if (work.GetPlayState() == PlayState::PLAYING)
+                    {
+                        GameSnapshot child;
+                        if (buffer.freeSnapshots.empty())
+                        {
+                            ++buffer.numSnapshots;
+                        }
+                        else
+                        {
+                            child = std::move(buffer.freeSnapshots.back());
+                            buffer.freeSnapshots.pop_back();
+                        }
+
+                        work.Snapshot(child);
+                        buffer.snapshots.emplace_back(std::move(child));
+                        buffer.snapshotNodes.emplace_back(nodeIdx);
+                    }
+                }
+            });
+
+        // Join the buffers in the order of the threads.
+        std::size_t wonNode = NO_NODE;
+        stats.nodesExpanded = 0;
+        stats.nodesGenerated = 0;
+
+        for (auto& buffer : buffers)
+        {
+            const auto base = static_cast<std::uint32_t>(nodes.size());
+            nodes.insert(nodes.end(), buffer.nodes.begin(), buffer.nodes.end());
+
+            if (wonNode == NO_NODE && buffer.wonNode != NO_NODE)
+            {
+                wonNode = base + buffer.wonNode;
+            }
+
+            for (std::size_t i = 0; i < buffer.snapshots.size(); ++i)
+            {
+                nextFrontierNodes.emplace_back(base + buffer.snapshotNodes[i]);
+                nextFrontier.emplace_back(std::move(buffer.snapshots[i]));
+            }
+
+            stats.nodesExpanded += buffer.nodesExpanded;
+            stats.nodesGenerated += buffer.nodesGenerated;
+
+            buffer.nodes.clear();
+            buffer.snapshots.clear();
+            buffer.snapshotNodes.clear();
+            buffer.wonNode = NO_NODE;
+        }
+
+        if (wonNode != NO_NODE)
+        {
+            for (std::size_t idx = wonNode; nodes[idx].parent != ROOT;
+                 idx = nodes[idx].parent)
+            {
+                solution.emplace_back(nodes[idx].action);
+            }
+            std::reverse(solution.begin(), solution.end());
+
+            UpdateStats();
+            return SearchStatus::SOLVED;
+        }
+
+        if (isLimitReached.load(std::memory_order_relaxed))
+        {
+            UpdateStats();
+            return SearchStatus::LIMIT_REACHED;
+        }
+
+        // Snapshots of this depth are reused for the next one.
+        for (std::size_t i = 0; i < frontier.size(); ++i)
+        {
+            buffers[i % buffers.size()].freeSnapshots.emplace_back(
+                std::move(frontier[i]));
+        }
+
+        frontier.clear();
+        frontierNodes.clear();
+        std::swap(frontier, nextFrontier);
+        std::swap(frontierNodes, nextFrontierNodes);
+    }
+
+    UpdateStats();
+    return SearchStatus::UNSOLVABLE;
+}
+}  // namespace baba_is_auto
@@ -12,7 +12,7 @@ namespace baba_is_auto
 {
 Direction RandomAgent::GetAction([[maybe_unused]] const Game& state)
 {
-    using Random = effolkronium::random_static;
+    using Random = effolkronium::random_thread_local;
 
     return static_cast<Direction>(
         Random::get(0, static_cast<int>(Direction::RIGHT)));
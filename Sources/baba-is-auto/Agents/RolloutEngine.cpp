@@ -0,0 +1,156 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <baba-is-auto/Agents/RolloutEngine.hpp>
+#include <baba-is-auto/Agents/SolverAgent.hpp>
+#include <baba-is-auto/Utils/Trace.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <stdexcept>
+
+namespace baba_is_auto
+{
+struct RolloutEngine::ThreadContext
+{
+    std::mt19937_64 rng;
+    std::unique_ptr<Game> work;
+    std::shared_ptr<IAgent> agent;
+
+    RolloutStats stats;
+};
+
+RolloutEngine::RolloutEngine(RolloutOptions options,
+                             const AgentFactory& agentFactory)
+    : m_options(options), m_pool(options.numThreads)
+{
+    m_contexts.resize(m_pool.GetNumThreads());
+    for (std::size_t i = 0; i < m_contexts.size(); ++i)
+    {
+        m_contexts[i].rng.seed(m_options.seed + i);
+
+        if (agentFactory)
+        {
+            m_contexts[i].agent = agentFactory();
+            if (!m_contexts[i].agent)
+            {
+                throw std::invalid_argument(
+                    "RolloutEngine - The agent factory returned nullptr.");
+            }
+        }
+    }
+}
+
+RolloutEngine::~RolloutEngine() = default;
+
+RolloutStats RolloutEngine::Run(const Game& game)
+{
+    const auto startTime = std::chrono::steady_clock::now();
+    const GameSnapshot snapshot = game.Snapshot();
+
+    m_pool.Run([&](std::size_t threadIdx) {
+        ThreadContext& context = m_contexts[threadIdx];
+        if (context.work)
+        {
+            *context.work = game;
+        }
+        else
+        {
+            context.work = std::make_unique<Game>(game);
+        }
+
+        context.stats = RolloutStats();
+        RunPlayouts(snapshot, threadIdx);
+    });
+
+    RolloutStats stats;
+    stats.numThreads = m_contexts.size();
+    for (const auto& context : m_contexts)
+    {
+        const RolloutStats& local = context.stats;
+
+        if (local.numWins > 0 &&
+            (stats.numWins == 0 || local.minWinSteps < stats.minWinSteps))
+        {
+            stats.minWinSteps = local.minWinSteps;
+        }
+
+        stats.numPlayouts += local.numPlayouts;
+        stats.numWins += local.numWins;
+        stats.numLosses += local.numLosses;
+        stats.numUnfinished += local.numUnfinished;
+        stats.totalSteps += local.totalSteps;
+        stats.totalWinSteps += local.totalWinSteps;
+        stats.maxSteps = std::max(stats.maxSteps, local.maxSteps);
+    }
+
+    stats.elapsedSeconds = std::chrono::duration<double>(
+                               std::chrono::steady_clock::now() - startTime)
+                               .count();
+
+    BABA_TRACE(TraceLevel::INFO, TraceCategory::AGENT,
+               "<Rollout> (playouts, wins, losses, steps/s) = ",
+               stats.numPlayouts, " ", stats.numWins, " ", stats.numLosses,
+               " ", stats.GetStepsPerSecond());
+
+    return stats;
+}
+
+const RolloutOptions& RolloutEngine::GetOptions() const
+{
+    return m_options;
+}
+
+void RolloutEngine::RunPlayouts(const GameSnapshot& snapshot,
+                                std::size_t threadIdx)
+{
+    ThreadContext& context = m_contexts[threadIdx];
+    Game& work = *context.work;
+    RolloutStats& stats = context.stats;
+
+    std::uniform_int_distribution<std::size_t> actionDist(
+        0, SEARCH_ACTIONS.size() - 1);
+
+    for (std::size_t playout = threadIdx; playout < m_options.numPlayouts;
+         playout += m_contexts.size())
+    {
+        work.RestoreTrusted(snapshot);
+
+        std::size_t depth = 0;
+        for (; depth < m_options.maxDepth &&
+               work.GetPlayState() == PlayState::PLAYING;
+             ++depth)
+        {
+            work.MovePlayer(context.agent
+                                ? context.agent->GetAction(work)
+                                : SEARCH_ACTIONS[actionDist(context.rng)]);
+        }
+
+        ++stats.numPlayouts;
+        stats.totalSteps += depth;
+        stats.maxSteps = std::max(stats.maxSteps, depth);
+
+        switch (work.GetPlayState())
+        {
+            case PlayState::WON:
+                ++stats.numWins;
+                stats.totalWinSteps += depth;
+                if (stats.numWins == 1 || depth < stats.minWinSteps)
+                {
+                    stats.minWinSteps = depth;
+                }
+                break;
+            case PlayState::LOST:
+                ++stats.numLosses;
+                break;
+            default:
+                ++stats.numUnfinished;
+                break;
+        }
+    }
+}
+}  // namespace baba_is_auto
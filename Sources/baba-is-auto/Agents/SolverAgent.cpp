@@ -0,0 +1,104 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <baba-is-auto/Agents/SolverAgent.hpp>
+#include <baba-is-auto/Utils/Trace.hpp>
+
+namespace baba_is_auto
+{
+SolverAgent::SolverAgent(SearchLimits limits) : m_limits(limits)
+{
+    // Do nothing
+}
+
+SearchStatus SolverAgent::Solve(const Game& game)
+{
+    m_solution.clear();
+    m_expectedHashes.clear();
+    m_nextAction = 0;
+    m_stats = SearchStats();
+    m_startTime = std::chrono::steady_clock::now();
+
+    m_status = Search(game, m_solution, m_stats);
+    m_stats.elapsedSeconds = GetElapsedSeconds();
+
+    BABA_TRACE(TraceLevel::INFO, TraceCategory::AGENT,
+               "<Solve> (status, length, expanded, nodes/s) = ",
+               static_cast<int>(m_status), " ", m_solution.size(), " ",
+               m_stats.nodesExpanded, " ", m_stats.GetNodesPerSecond());
+
+    if (m_status == SearchStatus::SOLVED)
+    {
+        // Remember the states on the way, so that GetAction can tell whether
+        // the game still goes as planned.
+        Game replay = game;
+        for (const Direction action : m_solution)
+        {
+            m_expectedHashes.emplace_back(replay.Hash());
+            replay.MovePlayer(action);
+        }
+    }
+
+    return m_status;
+}
+
+Direction SolverAgent::GetAction(const Game& state)
+{
+    if (m_nextAction >= m_solution.size() ||
+        m_expectedHashes[m_nextAction] != state.Hash())
+    {
+        if (Solve(state) != SearchStatus::SOLVED || m_solution.empty())
+        {
+            return Direction::NONE;
+        }
+    }
+
+    return m_solution[m_nextAction++];
+}
+
+const std::vector<Direction>& SolverAgent::GetSolution() const
+{
+    return m_solution;
+}
+
+const SearchStats& SolverAgent::GetStats() const
+{
+    return m_stats;
+}
+
+SearchStatus SolverAgent::GetStatus() const
+{
+    return m_status;
+}
+
+const SearchLimits& SolverAgent::GetLimits() const
+{
+    return m_limits;
+}
+
+void SolverAgent::SetLimits(SearchLimits limits)
+{
+    m_limits = limits;
+}
+
+bool SolverAgent::IsLimitReached(const SearchStats& stats) const
+{
+    if (m_limits.maxNodes != 0 && stats.nodesExpanded >= m_limits.maxNodes)
+    {
+        return true;
+    }
+
+    return m_limits.maxSeconds > 0.0 &&
+           GetElapsedSeconds() >= m_limits.maxSeconds;
+}
+
+double SolverAgent::GetElapsedSeconds() const
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                         m_startTime)
+        .count();
+}
+}  // namespace baba_is_auto
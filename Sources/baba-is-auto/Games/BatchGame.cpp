@@ -0,0 +1,183 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <baba-is-auto/Games/BatchGame.hpp>
+
+#include <stdexcept>
+
+namespace baba_is_auto
+{
+BatchGame::BatchGame(std::string_view filename, std::size_t numGames,
+                     std::size_t numThreads, StepRewards rewards,
+                     std::size_t maxEpisodeSteps,
+                     std::shared_ptr<const ObservationEncoder> encoder)
+    : m_pool(numThreads),
+      m_rewards(rewards),
+      m_maxEpisodeSteps(maxEpisodeSteps),
+      m_encoder(std::move(encoder))
+{
+    if (numGames == 0)
+    {
+        throw std::invalid_argument("BatchGame - numGames must not be zero.");
+    }
+
+    if (!m_encoder)
+    {
+        // The default encoder is a static, so it is not owned.
+        m_encoder = std::shared_ptr<const ObservationEncoder>(
+            std::shared_ptr<const ObservationEncoder>(),
+            &ObservationEncoder::GetDefault());
+    }
+
+    // Load the map once and copy it to the other games.
+    m_games.reserve(numGames);
+    m_games.emplace_back(filename);
+    m_games.resize(numGames, m_games.front());
+
+    m_observationSize = m_encoder->GetTensorSize(m_games.front());
+    m_observations.resize(numGames * m_observationSize);
+    m_stepRewards.resize(numGames, 0.0f);
+    m_dones.resize(numGames, 0);
+    m_playStates.resize(numGames, PlayState::PLAYING);
+    m_episodeSteps.resize(numGames, 0);
+
+    Reset();
+}
+
+void BatchGame::Reset()
+{
+    m_pool.ParallelFor(m_games.size(), GAMES_PER_TASK,
+                       [this](std::size_t, std::size_t idx) {
+                           ResetGame(idx);
+                           m_stepRewards[idx] = 0.0f;
+                           m_dones[idx] = 0;
+                           m_playStates[idx] = m_games[idx].GetPlayState();
+                       });
+}
+
+void BatchGame::Step(const Direction* actions)
+{
+    for (std::size_t idx = 0; idx < m_games.size(); ++idx)
+    {
+        if (actions[idx] > Direction::RIGHT)
+        {
+            throw std::invalid_argument("BatchGame - Invalid action.");
+        }
+    }
+
+    m_pool.ParallelFor(
+        m_games.size(), GAMES_PER_TASK, [&](std::size_t, std::size_t idx) {
+            Game& game = m_games[idx];
+
+            game.MovePlayer(actions[idx]);
+            ++m_episodeSteps[idx];
+
+            const PlayState playState = game.GetPlayState();
+            m_playStates[idx] = playState;
+
+            if (playState == PlayState::WON)
+            {
+                m_stepRewards[idx] = m_rewards.win;
+            }
+            else if (playState == PlayState::LOST)
+            {
+                m_stepRewards[idx] = m_rewards.lose;
+            }
+            else
+            {
+                m_stepRewards[idx] = m_rewards.step;
+            }
+
+            const bool isDone =
+                playState != PlayState::PLAYING ||
+                (m_maxEpisodeSteps != 0 &&
+                 m_episodeSteps[idx] >= m_maxEpisodeSteps);
+            m_dones[idx] = isDone ? 1 : 0;
+
+            if (isDone)
+            {
+                ResetGame(idx);
+            }
+            else
+            {
+                // The observation holds the state before this step.
+                m_encoder->EncodeChanges(
+                    game, m_observations.data() + idx * m_observationSize);
+            }
+        });
+}
+
+void BatchGame::Step(const std::vector<Direction>& actions)
+{
+    if (actions.size() != m_games.size())
+    {
+        throw std::invalid_argument(
+            "BatchGame - The number of actions must match the number of "
+            "games.");
+    }
+
+    Step(actions.data());
+}
+
+std::size_t BatchGame::GetNumGames() const
+{
+    return m_games.size();
+}
+
+const ObservationEncoder& BatchGame::GetEncoder() const
+{
+    return *m_encoder;
+}
+
+std::size_t BatchGame::GetObservationSize() const
+{
+    return m_observationSize;
+}
+
+Game& BatchGame::GetGame(std::size_t idx)
+{
+    return m_games.at(idx);
+}
+
+const Game& BatchGame::GetGame(std::size_t idx) const
+{
+    return m_games.at(idx);
+}
+
+const std::vector<float>& BatchGame::GetObservations() const
+{
+    return m_observations;
+}
+
+const std::vector<float>& BatchGame::GetRewards() const
+{
+    return m_stepRewards;
+}
+
+const std::vector<std::uint8_t>& BatchGame::GetDones() const
+{
+    return m_dones;
+}
+
+const std::vector<PlayState>& BatchGame::GetPlayStates() const
+{
+    return m_playStates;
+}
+
+const std::vector<std::size_t>& BatchGame::GetEpisodeSteps() const
+{
+    return m_episodeSteps;
+}
+
+void BatchGame::ResetGame(std::size_t idx)
+{
+    m_games[idx].Reset();
+    m_episodeSteps[idx] = 0;
+
+    m_encoder->Encode(m_games[idx],
+                      m_observations.data() + idx * m_observationSize);
+}
+}  // namespace baba_is_auto
@@ -0,0 +1,169 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <baba-is-auto/Games/Bitboard.hpp>
+
+#include <algorithm>
+
+namespace baba_is_auto
+{
+Bitboard::Bitboard(std::size_t numBits)
+    : m_numBits(numBits), m_words((numBits + 63) / 64, 0)
+{
+    // Do nothing
+}
+
+Bitboard::Bitboard(std::size_t numBits, const std::uint64_t* words)
+    : m_numBits(numBits), m_words(words, words + (numBits + 63) / 64)
+{
+    // Do nothing
+}
+
+void Bitboard::Clear()
+{
+    std::fill(m_words.begin(), m_words.end(), 0);
+}
+
+bool Bitboard::Any() const
+{
+    for (const std::uint64_t word : m_words)
+    {
+        if (word != 0)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+std::size_t Bitboard::Count() const
+{
+    std::size_t count = 0;
+
+    for (const std::uint64_t word : m_words)
+    {
+        count += PopCount(word);
+    }
+
+    return count;
+}
+
+void Bitboard::OrWords(const std::uint64_t* words)
+{
+    for (std::size_t i = 0; i < m_words.size(); ++i)
+    {
+        m_words[i] |= words[i];
+    }
+}
+
+Bitboard& Bitboard::operator|=(const Bitboard& rhs)
+{
+    OrWords(rhs.m_words.data());
+    return *this;
+}
+
+Bitboard& Bitboard::operator&=(const Bitboard& rhs)
+{
+    for (std::size_t i = 0; i < m_words.size(); ++i)
+    {
+        m_words[i] &= rhs.m_words[i];
+    }
+
+    return *this;
+}
+
+Bitboard& Bitboard::AndNot(const Bitboard& rhs)
+{
+    for (std::size_t i = 0; i < m_words.size(); ++i)
+    {
+        m_words[i] &= ~rhs.m_words[i];
+    }
+
+    return *this;
+}
+
+Bitboard& Bitboard::Flip()
+{
+    for (std::uint64_t& word : m_words)
+    {
+        word = ~word;
+    }
+
+    ClearUnusedBits();
+    return *this;
+}
+
+Bitboard& Bitboard::ShiftRight(std::size_t n)
+{
+    const std::size_t numWords = m_words.size();
+    const std::size_t wordShift = n >> 6;
+    const std::size_t bitShift = n & 63;
+
+    // Each word only reads words after it, so it is shifted in place from
+    // the front.
+    for (std::size_t i = 0; i < numWords; ++i)
+    {
+        const std::size_t src = i + wordShift;
+        std::uint64_t word = 0;
+
+        if (src < numWords)
+        {
+            word = m_words[src] >> bitShift;
+            if (bitShift != 0 && src + 1 < numWords)
+            {
+                word |= m_words[src + 1] << (64 - bitShift);
+            }
+        }
+
+        m_words[i] = word;
+    }
+
+    return *this;
+}
+
+Bitboard& Bitboard::ShiftLeft(std::size_t n)
+{
+    const std::size_t numWords = m_words.size();
+    const std::size_t wordShift = n >> 6;
+    const std::size_t bitShift = n & 63;
+
+    // Each word only reads words before it, so it is shifted in place from
+    // the back.
+    for (std::size_t i = numWords; i-- > 0;)
+    {
+        std::uint64_t word = 0;
+
+        if (i >= wordShift)
+        {
+            const std::size_t src = i - wordShift;
+            word = m_words[src] << bitShift;
+            if (bitShift != 0 && src >= 1)
+            {
+                word |= m_words[src - 1] >> (64 - bitShift);
+            }
+        }
+
+        m_words[i] = word;
+    }
+
+    ClearUnusedBits();
+    return *this;
+}
+
+bool Bitboard::operator==(const Bitboard& rhs) const
+{
+    return m_numBits == rhs.m_numBits && m_words == rhs.m_words;
+}
+
+void Bitboard::ClearUnusedBits()
+{
+    if ((m_numBits & 63) != 0)
+    {
+        m_words.back() &= (std::uint64_t{ 1 } << (m_numBits & 63)) - 1;
+    }
+}
+}  // namespace baba_is_auto
@@ -6,14 +6,33 @@
 
 #include <baba-is-auto/Games/Game.hpp>
 
+#include <algorithm>
+#include <stdexcept>
+
 namespace baba_is_auto
 {
 
 Game::Game(std::string_view filename)
+    : Game(std::make_shared<const LevelTemplate>(filename))
 {
-    m_map.Load(filename);
-    m_ruleManager.ParseRules(m_map);
-    m_playState = PlayState::PLAYING;
+    // Do nothing
+}
+
+Game::Game(const LevelCorpus& corpus, std::size_t idx)
+    : Game(std::make_shared<const LevelTemplate>(corpus, idx))
+{
+    // Do nothing
+}
+
+Game::Game(std::shared_ptr<const LevelTemplate> level)
+    : m_template(std::move(level))
+{
+    if (!m_template)
+    {
+        throw std::invalid_argument("Game - The level must not be null.");
+    }
+
+    Reset();
 
     std::random_device rnd;
     mt.seed(rnd());
@@ -21,11 +40,26 @@ Game::Game(std::string_view filename)
 
 void Game::Reset()
 {
-    m_map.Reset();
-    m_ruleManager.ParseRules(m_map);
+    // A map made from the template only copies its flat state back. Either
+    // way, copying reuses the memory of the map and the rules.
+    if (m_map.SharesInitState(m_template->GetMap()))
+    {
+        m_map.Reset();
+    }
+    else
+    {
+        m_map = m_template->GetMap();
+        m_map.MarkAllCellsDirty();
+    }
+    m_ruleManager = m_template->GetRuleManager();
     m_playState = PlayState::PLAYING;
 }
 
+const std::shared_ptr<const LevelTemplate>& Game::GetTemplate() const
+{
+    return m_template;
+}
+
 Map& Game::GetMap()
 {
     return m_map;
@@ -41,25 +75,87 @@ RuleManager& Game::GetRuleManager()
     return m_ruleManager;
 }
 
+const RuleManager& Game::GetRuleManager() const
+{
+    return m_ruleManager;
+}
+
 PlayState Game::GetPlayState() const
 {
     return m_playState;
 }
 
+std::uint64_t Game::Hash() const
+{
+    // Rules and the play state are derived from the objects on the map.
+    return m_map.GetHash();
+}
+
+GameSnapshot Game::Snapshot() const
+{
+    GameSnapshot snapshot;
+    Snapshot(snapshot);
+
+    return snapshot;
+}
+
+void Game::Snapshot(GameSnapshot& snapshot) const
+{
+    snapshot.clear();
+
+    WriteBytes(snapshot, m_playState);
+    m_map.WriteState(snapshot);
+    m_ruleManager.WriteState(snapshot);
+}
+
+void Game::Restore(const GameSnapshot& snapshot)
+{
+    const std::uint8_t* end = snapshot.data() + snapshot.size();
+
+    // The whole snapshot is checked before anything is read, so that a bad
+    // snapshot leaves the game as it was.
+    const std::uint8_t* in = snapshot.data();
+    PlayState playState = PlayState::INVALID;
+    ReadBytes(in, end, playState);
+    if (playState < PlayState::INVALID || playState > PlayState::LOST)
+    {
+        throw std::invalid_argument(
+            "Game - The snapshot has an invalid play state.");
+    }
+    m_map.CheckState(in, end);
+    m_ruleManager.CheckState(in, end, m_map);
+    if (in != end)
+    {
+        throw std::invalid_argument("Game - The snapshot has trailing bytes.");
+    }
+
+    RestoreTrusted(snapshot);
+}
+
+void Game::RestoreTrusted(const GameSnapshot& snapshot)
+{
+    const std::uint8_t* in = snapshot.data();
+    const std::uint8_t* end = snapshot.data() + snapshot.size();
+
+    ReadBytes(in, end, m_playState);
+    m_map.ReadState(in, end);
+    m_ruleManager.ReadState(in, end);
+}
+
 int Game::RandInt(int min, int max)
 {
     std::uniform_int_distribution<> rand(min, max);
     return rand(mt);
 }
 
-Direction Game::SetRandomDirectionToObject(Object& obj){
+Direction Game::SetRandomDirectionToObject(ObjectSlot slot){
     Direction dirs[] = {Direction::LEFT,
 			Direction::RIGHT,
 			Direction::UP,
 			Direction::DOWN};
     Direction dir = dirs[RandInt(0, 3)];
     dir = Direction::LEFT;
-    obj.SetDirection(dir);
+    m_map.SetDirection(slot, dir);
     return dir;
 
 }
@@ -69,6 +165,21 @@ void Game::MovePlayer(Direction dir)
 
     // This function is directly called in simulation.
 
+    using Clock = std::chrono::steady_clock;
+    const Clock::time_point stepBegin =
+        m_isProfiling ? Clock::now() : Clock::time_point();
+    const std::uint64_t prevNumComputations =
+        m_moveResolver.GetNumComputations();
+
+    // Only the squares changed by this step are listed after it.
+    m_map.ClearDirtyCells();
+
+    // The map or the rules may have been changed since the last step.
+    m_moveResolver.Invalidate();
+
+    m_events.clear();
+    const PlayState prevPlayState = m_playState;
+
     /*
       Notes (letra418):
       In the original baba-is-you, parsing of rules occurs many times in a step and the flow is as follows:
@@ -85,13 +196,13 @@ void Game::MovePlayer(Direction dir)
 
     // ===========================
     // 1-1. Normal movements
-    ProcessYOU(dir);
-    ProcessMOVE();
-    ProcessSHIFT();
+    RunPhase(GamePhase::YOU, [&]() { ProcessYOU(dir); });
+    RunPhase(GamePhase::MOVE, [&]() { ProcessMOVE(); });
+    RunPhase(GamePhase::SHIFT, [&]() { ProcessSHIFT(); });
     // m_ruleManager.ParseRules(m_map);
     // ===========================
     // 2. Objects changes
-    ProcessIS();
+    RunPhase(GamePhase::IS, [&]() { ProcessIS(); });
     //m_ruleManager.ParseRules(m_map);
 
     // ===========================
@@ -101,14 +212,128 @@ void Game::MovePlayer(Direction dir)
 
     // ===========================
     // 4. Objects vanishments
-    ProcessSINK();
-    ProcessHOTAndMELT();
-    ProcessDEFEAT();
-    m_ruleManager.ParseRules(m_map);
+    RunPhase(GamePhase::SINK, [&]() { ProcessSINK(); });
+    RunPhase(GamePhase::HOT_AND_MELT, [&]() { ProcessHOTAndMELT(); });
+    RunPhase(GamePhase::DEFEAT, [&]() { ProcessDEFEAT(); });
+
+    // Rules only change when a text object has changed.
+    RunPhase(GamePhase::RULES, [&]() {
+        if (m_isRecordingEvents && m_map.HasDirtyLines())
+        {
+            const std::vector<Rule> prevRules = m_ruleManager.GetAllRules();
+            m_ruleManager.UpdateRules(m_map);
+            RecordRuleEvents(prevRules);
+        }
+        else
+        {
+            m_ruleManager.UpdateRules(m_map);
+        }
+    });
 
     // ===========================
     // 5. Check Won/List
-    CheckPlayState();
+    RunPhase(GamePhase::PLAY_STATE, [&]() { CheckPlayState(); });
+
+    if (m_isRecordingEvents && m_playState != prevPlayState)
+    {
+        StepEvent event;
+        event.type = StepEventType::PLAY_STATE_CHANGED;
+        event.playState = m_playState;
+        m_events.emplace_back(event);
+    }
+
+    if (m_isProfiling)
+    {
+        m_profile.AddCount(
+            GameCounter::MOVABLE_BOARDS,
+            m_moveResolver.GetNumComputations() - prevNumComputations);
+        m_profile.AddPhaseTime(
+            GamePhase::STEP,
+            static_cast<std::uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    Clock::now() - stepBegin)
+                    .count()));
+    }
+}
+
+void Game::SetRecordEvents(bool isRecording)
+{
+    m_isRecordingEvents = isRecording;
+    m_events.clear();
+}
+
+bool Game::IsRecordingEvents() const
+{
+    return m_isRecordingEvents;
+}
+
+const std::vector<StepEvent>& Game::GetEvents() const
+{
+    return m_events;
+}
+
+void Game::SetProfiling(bool isProfiling)
+{
+    m_isProfiling = isProfiling;
+    if (m_isProfiling)
+    {
+        m_profile.Enable();
+    }
+}
+
+bool Game::IsProfiling() const
+{
+    return m_isProfiling;
+}
+
+const GameProfile& Game::GetProfile() const
+{
+    return m_profile;
+}
+
+void Game::ResetProfile()
+{
+    m_profile.Reset();
+}
+
+void Game::RecordRuleEvents(const std::vector<Rule>& prevRules)
+{
+    const std::vector<Rule> rules = m_ruleManager.GetAllRules();
+
+    const auto Record = [this](StepEventType type, const Rule& rule) {
+        StepEvent event;
+        event.type = type;
+        event.subject = rule.GetSubject();
+        event.op = rule.GetOperator();
+        event.predicate = rule.GetPredicate();
+        m_events.emplace_back(event);
+    };
+
+    // The same rule can be made more than once, so each rule is matched
+    // with one rule of before at most.
+    std::vector<Rule> unmatched = prevRules;
+    std::vector<Rule> added;
+    for (auto& rule : rules)
+    {
+        const auto iter = std::find(unmatched.begin(), unmatched.end(), rule);
+        if (iter != unmatched.end())
+        {
+            unmatched.erase(iter);
+        }
+        else
+        {
+            added.emplace_back(rule);
+        }
+    }
+
+    for (auto& rule : unmatched)
+    {
+        Record(StepEventType::RULE_REMOVED, rule);
+    }
+    for (auto& rule : added)
+    {
+        Record(StepEventType::RULE_ADDED, rule);
+    }
 }
 
 Direction GetReverseDirection(Direction dir){
@@ -177,39 +402,21 @@ std::tuple<int, int> GetPositionOfPulledObject(std::size_t x, std::size_t y,
 }
 
 
-bool Game::CanMove(std::size_t x, std::size_t y, Direction dir, 
-		   const Object& srcObject) const
+bool Game::CanMove(std::size_t x, std::size_t y, Direction dir)
 {
-    const auto width = static_cast<int>(m_map.GetWidth());
-    const auto height = static_cast<int>(m_map.GetHeight());
-
-    int _x;
-    int _y;
-    std::tie(_x, _y) = GetPositionAfterMove(x, y, dir);
+    /*
+      Notes (letra418):
+      - TODO: implement SHUT, OPEN, PULL, WEAK, SWAP, FLOAT
+    */
 
-    // Check boundary
-    if (_x < 0 || _x >= width || _y < 0 || _y >= height){
-        return false;
+    if (m_isProfiling)
+    {
+        m_profile.AddCount(GameCounter::CAN_MOVE);
     }
 
-    const ObjectContainer& dstObjects = m_map.GetObjects(_x, _y);
-
-    // return false if one of objects at the target postion cannot move to the direction
-    for (auto & obj: dstObjects){
-	/*
-	  Notes (letra418):
-	  - TODO: implement SHUT, OPEN, PULL, WEAK, SWAP, FLOAT
-	*/
-
-	if (m_ruleManager.HasType(obj, m_map, ObjectType::PUSH) &&
-	    !CanMove(_x, _y, dir, obj)){
-	    return false;
-	}
-	else if (m_ruleManager.HasType(obj, m_map, ObjectType::STOP)){
-	    return false;
-	}
-    }
-    return true;
+    // The movable squares of a direction are computed at once from the
+    // PUSH and STOP bitboards and kept until a blocker changes.
+    return m_moveResolver.CanMove(m_map, m_ruleManager, x, y, dir);
 }
 
 void Game::ProcessYOU(Direction dir)
@@ -249,17 +456,16 @@ void Game::ProcessYOU(Direction dir)
     */
 
     for (auto& [obj_id, x, y] : obj_ids){
- 	Object& srcObject = m_map.GetObject(obj_id, x, y);
-	srcObject.SetDirection(dir); // Notes: Segmentation Fault
-	if (!CanMove(x, y, dir, srcObject)) continue;
-	srcObject.SetMoveFlag(dir);
+	const ObjectSlot slot = m_map.FindSlot(obj_id, x, y);
+	m_map.SetDirection(slot, dir);
+	if (!CanMove(x, y, dir)) continue;
+	m_map.SetMoveFlag(slot, dir);
     }
 
     // Setting a move direction to pushed objects needs to be done after setting it to moving objects.
     // Otherwise a pushed object can set a different direction to moving objects.
     for (auto& [obj_id, x, y] : obj_ids){
- 	Object& srcObject = m_map.GetObject(obj_id, x, y);
-	if (!CanMove(x, y, dir, srcObject)) continue;
+	if (!CanMove(x, y, dir)) continue;
  	std::tie(_x, _y) = GetPositionAfterMove(x, y, dir);
 	SetPushedDirToObjects(_x, _y, dir);
     }
@@ -272,27 +478,27 @@ void Game::ProcessSHIFT()
     auto obj_ids = FindObjectIdsAndPositionsByType(ObjectType::SHIFT);
 
     for (auto& [obj_id, x, y] : obj_ids){
-    	Object& obj = m_map.GetObject(obj_id, x, y);
-    	dir = obj.GetDirection();
+	const ObjectSlot slot = m_map.FindSlot(obj_id, x, y);
+    	dir = m_map.GetDirection(slot);
     	if (dir == Direction::NONE){
-    	    dir = SetRandomDirectionToObject(obj);
+    	    dir = SetRandomDirectionToObject(slot);
     	}
-    	for (auto& tgtObj: m_map.GetObjects(x, y)){
-    	    if (tgtObj.GetId() == obj.GetId()) continue;
-    	    tgtObj.SetDirection(dir);
-    	    tgtObj.SetMoveFlag(dir);
+    	for (const ObjectSlot tgtSlot : m_map.GetSlots(x, y)){
+    	    if (tgtSlot == slot) continue;
+    	    m_map.SetDirection(tgtSlot, dir);
+    	    m_map.SetMoveFlag(tgtSlot, dir);
     	}
     }
 
     int _x;
     int _y;
     for (auto& [obj_id, x, y] : obj_ids){
-    	Object& obj = m_map.GetObject(obj_id, x, y);
+	const ObjectSlot slot = m_map.FindSlot(obj_id, x, y);
 	// If there are no objects on the SHIFT object, it pushes nothing.
 	bool something_on_shift = false;
-    	dir = obj.GetDirection();
-	for (auto& tgtObj: m_map.GetObjects(x, y)){
-	    if (tgtObj.GetId() != obj.GetId()){
+    	dir = m_map.GetDirection(slot);
+	for (const ObjectSlot tgtSlot : m_map.GetSlots(x, y)){
+	    if (tgtSlot != slot){
 		something_on_shift = true;
 	    }
 	}
@@ -315,31 +521,29 @@ void Game::ProcessMOVE()
     auto obj_ids = FindObjectIdsAndPositionsByType(ObjectType::MOVE);
 
     for (auto& [obj_id, x, y] : obj_ids){
-    	Object& obj = m_map.GetObject(obj_id, x, y);
-	dir = obj.GetDirection();
+	const ObjectSlot slot = m_map.FindSlot(obj_id, x, y);
+	dir = m_map.GetDirection(slot);
 	if (dir == Direction::NONE){
-	    dir = SetRandomDirectionToObject(obj);
-	    dir = obj.GetDirection();
+	    dir = SetRandomDirectionToObject(slot);
 	}
 	revdir = GetReverseDirection(dir);
 
-    	if (CanMove(x, y, dir, obj)){
-	    std::tie(_x, _y) = GetPositionAfterMove(x, y, dir);
-	    obj.SetMoveFlag(dir);
-	} else if (CanMove(x, y, revdir, obj)){
-	    obj.SetDirection(revdir);
-	    obj.SetMoveFlag(revdir);
+    	if (CanMove(x, y, dir)){
+	    m_map.SetMoveFlag(slot, dir);
+	} else if (CanMove(x, y, revdir)){
+	    m_map.SetDirection(slot, revdir);
+	    m_map.SetMoveFlag(slot, revdir);
 	} else {
-	    obj.SetDirection(revdir);
+	    m_map.SetDirection(slot, revdir);
 	}
     }
 
     for (auto& [obj_id, x, y] : obj_ids){
-    	Object& obj = m_map.GetObject(obj_id, x, y);
-	dir = obj.GetDirection();
+	const ObjectSlot slot = m_map.FindSlot(obj_id, x, y);
+	dir = m_map.GetDirection(slot);
 	revdir = GetReverseDirection(dir);
 
-    	if (CanMove(x, y, dir, obj)){
+    	if (CanMove(x, y, dir)){
 	    std::tie(_x, _y) = GetPositionAfterMove(x, y, dir);
 	    SetPushedDirToObjects(_x, _y, dir);
 	} else {
@@ -370,8 +574,7 @@ void Game::ProcessIS()
 
 	auto obj_ids = FindObjectIdsAndPositionsByType(subjType);
 	for (auto& [obj_id, x, y] : obj_ids){
-	    Object& obj = m_map.GetObject(obj_id, x, y);
-	    obj.SetChangeFlag(predType);
+	    m_map.SetChangeFlag(m_map.FindSlot(obj_id, x, y), predType);
 	}
     }
     ResolveAllChangeFlags();
@@ -417,10 +620,10 @@ bool Game::ProcessSINK()
 
     // All objects on SINK object and itself are removed.
     for (auto& [_, x, y] : obj_ids){
-	auto& objs = m_map.GetObjects(x, y);
-	if (objs.size() > 1){
-	    for (auto& obj : objs){
-		obj.SetRemoveFlag(true);
+	const SlotRange slots = m_map.GetSlots(x, y);
+	if (slots.size() > 1){
+	    for (const ObjectSlot slot : slots){
+		m_map.SetRemoveFlag(slot, true);
 		happened = true;
 	    }
 	}
@@ -434,11 +637,11 @@ bool Game::ProcessHOTAndMELT()
     bool happened = false;
     auto obj_ids = FindObjectIdsAndPositionsByType(ObjectType::MELT);
     for (auto& [melt_id, x, y] : obj_ids){
-	auto& meltObj = m_map.GetObject(melt_id, x, y);
+	const ObjectSlot meltSlot = m_map.FindSlot(melt_id, x, y);
 
-	for (auto& obj : m_map.GetObjects(x, y)){
-	    if (m_ruleManager.HasType(obj, m_map, ObjectType::HOT)){
-		meltObj.SetRemoveFlag(true);
+	for (const ObjectSlot slot : m_map.GetSlots(x, y)){
+	    if (HasType(m_map.GetType(slot), ObjectType::HOT)){
+		m_map.SetRemoveFlag(meltSlot, true);
 		happened = true;
 	    }
 	}
@@ -452,11 +655,11 @@ bool Game::ProcessDEFEAT()
     bool happened = false;
     auto obj_ids = FindObjectIdsAndPositionsByType(ObjectType::YOU);
     for (auto& [you_id, x, y] : obj_ids){
-	auto& youObj = m_map.GetObject(you_id, x, y);
+	const ObjectSlot youSlot = m_map.FindSlot(you_id, x, y);
 
-	for (auto& obj : m_map.GetObjects(x, y)){
-	    if (m_ruleManager.HasType(obj, m_map, ObjectType::DEFEAT)){
-		youObj.SetRemoveFlag(true);
+	for (const ObjectSlot slot : m_map.GetSlots(x, y)){
+	    if (HasType(m_map.GetType(slot), ObjectType::DEFEAT)){
+		m_map.SetRemoveFlag(youSlot, true);
 		happened = true;
 	    }
 	}
@@ -493,9 +696,8 @@ void Game::CheckPlayState() // todo
         return;
     }
     for (auto& [_, x, y] : obj_ids){
-	auto& objs = m_map.GetObjects(x, y);
-	for (auto & obj: objs){
-	    if (m_ruleManager.HasType(obj, m_map, ObjectType::WIN)){
+	for (const ObjectSlot slot : m_map.GetSlots(x, y)){
+	    if (HasType(m_map.GetType(slot), ObjectType::WIN)){
 		m_playState = PlayState::WON;
 	    }
 	}
@@ -503,27 +705,35 @@ void Game::CheckPlayState() // todo
 }
 
 // Instead of returning references to objects, this function returns tuples of (ObjectId, X, Y). This is due to subsequent lost of references caused by memory reallocation of std::vector when an object is moved from a square to another square..
+// Only the squares in the bitboard of the type are visited. They are visited in row-major order, so the result is the same as scanning the whole map.
 std::vector<PositionalObject> Game::FindObjectIdsAndPositionsByType(ObjectType objtype){
     std::vector<PositionalObject> res;
 
+    Bitboard board;
+    if (IsIconType(objtype)){
+	board = m_map.GetBitboard(objtype);
+    } else if (IsPropertyType(objtype)){
+	board = m_ruleManager.GetPropertyBitboard(m_map, objtype);
+    } else {
+	return res;
+    }
+
     const std::size_t width = m_map.GetWidth();
-    const std::size_t height = m_map.GetHeight();
 
-    for (std::size_t y = 0; y < height; ++y){
-        for (std::size_t x = 0; x < width; ++x){
-	    ObjectContainer& objs = m_map.GetObjects(x, y);
-	    for (auto itr = objs.begin(), e = objs.end(); itr != e; ++itr){ 
-		if (IsIconType(objtype) && (itr->GetType() == objtype)){
-		    std::tuple t = std::make_tuple(itr->GetId(), x, y);
-		    res.emplace_back(t);
-		} else if (IsPropertyType(objtype) && m_ruleManager.HasType(*itr, m_map, objtype)){
-		    std::tuple t = std::make_tuple(itr->GetId(), x, y);
-		    // std::tuple t = std::tie(itr->GetId(), x, y);
-		    res.emplace_back(t);
-		}
+    board.ForEach([&](std::size_t cell){
+	const std::size_t x = cell % width;
+	const std::size_t y = cell / width;
+	const SlotRange slots = m_map.GetSlots(x, y);
+	if (m_isProfiling){
+	    m_profile.AddCount(GameCounter::OBJECTS_SCANNED, slots.size());
+	}
+	for (const ObjectSlot slot : slots){
+	    const ObjectType type = m_map.GetType(slot);
+	    if (IsIconType(objtype) ? (type == objtype) : HasType(type, objtype)){
+		res.emplace_back(m_map.GetId(slot), x, y);
 	    }
-        }
-    }
+	}
+    });
 
     return res;
 }
@@ -532,19 +742,19 @@ void Game::SetPushedDirToObjects(std::size_t x, std::size_t y, Direction dir){
     // Recursively add pushed_flag to PUSH objects on squares.
     // This function stops when no PUSH objects exist on the next square.
 
-    ObjectContainer& objs = m_map.GetObjects(x, y);
+    // A MOVE object that is blocked both ways pushes toward the edge of the map.
+    if (x >= m_map.GetWidth() || y >= m_map.GetHeight()){
+	return;
+    }
+
     bool continue_pushing = false;
 
-    for (auto itr = objs.begin(), e = objs.end(); itr != e; ++itr){
-	if (m_ruleManager.HasType(*itr, m_map, ObjectType::PUSH)){
+    for (const ObjectSlot slot : m_map.GetSlots(x, y)){
+	if (HasType(m_map.GetType(slot), ObjectType::PUSH)){
 	    // Skipped if an object was already pushed from another direction (e.g., MOVE objects can push an object from two directions).
-	    if (itr->GetMoveFlag() == Direction::NONE){
-		if (CanMove(x, y, dir, *itr)){
-		    itr->SetMoveFlag(dir);
-		    itr->SetDirection(dir);
-		}
-		itr->SetMoveFlag(dir);
-		itr->SetDirection(dir);
+	    if (m_map.GetMoveFlag(slot) == Direction::NONE){
+		m_map.SetMoveFlag(slot, dir);
+		m_map.SetDirection(slot, dir);
 		continue_pushing = true;
 	    }
 	}
@@ -563,49 +773,78 @@ void Game::SetPushedDirToObjects(std::size_t x, std::size_t y, Direction dir){
 void Game::ResolveAllChangeFlags(){
     const std::size_t width = m_map.GetWidth();
     const std::size_t height = m_map.GetHeight();
+    if (m_isProfiling){
+	m_profile.AddCount(GameCounter::OBJECTS_SCANNED, m_map.GetNumObjects());
+    }
     ObjectType change_to;
     std::vector<std::tuple<ObjectId, size_t, size_t, ObjectType>> objsChangeSchedule;
     std::tuple<ObjectId, size_t, size_t, ObjectType> s;
     for (std::size_t y = 0; y < height; ++y){
         for (std::size_t x = 0; x < width; ++x){
-	    ObjectContainer& objs = m_map.GetObjects(x, y);
-	    for (auto itr = objs.begin(), e = objs.end(); itr != e; ++itr){
-		change_to = itr->GetChangeFlag();
-		if (change_to != itr->GetType()){
-		    s = std::make_tuple(itr->GetId(), x, y, change_to);
+	    for (const ObjectSlot slot : m_map.GetSlots(x, y)){
+		change_to = m_map.GetChangeFlag(slot);
+		if (change_to != m_map.GetType(slot)){
+		    s = std::make_tuple(m_map.GetId(slot), x, y, change_to);
 		    objsChangeSchedule.emplace_back(s);
 		}
 	    }
 	}
     }
     for (auto& [obj_id, x, y, change_to] : objsChangeSchedule){
-	Object& obj = m_map.GetObject(obj_id, x, y);
-	obj.SetType(change_to);
-	obj.SetChangeFlag(change_to);
+	const ObjectSlot slot = m_map.FindSlot(obj_id, x, y);
+	if (m_isRecordingEvents){
+	    StepEvent event;
+	    event.type = StepEventType::TYPE_CHANGED;
+	    event.id = obj_id;
+	    event.objectType = m_map.GetType(slot);
+	    event.newType = change_to;
+	    event.x = static_cast<std::uint16_t>(x);
+	    event.y = static_cast<std::uint16_t>(y);
+	    m_events.emplace_back(event);
+	}
+	m_map.SetType(slot, change_to);
+	m_map.SetChangeFlag(slot, change_to);
+    }
+    if (!objsChangeSchedule.empty()){
+	m_moveResolver.Invalidate();
     }
 }
 
 void Game::ResolveAllRemoveFlags(){
     const std::size_t width = m_map.GetWidth();
     const std::size_t height = m_map.GetHeight();
+    if (m_isProfiling){
+	m_profile.AddCount(GameCounter::OBJECTS_SCANNED, m_map.GetNumObjects());
+    }
 
     std::vector<std::tuple<ObjectId, size_t, size_t>> objsRemoveSchedule;
     std::tuple<ObjectId, size_t, size_t> s;
 
     for (std::size_t y = 0; y < height; ++y){
         for (std::size_t x = 0; x < width; ++x){
-	    ObjectContainer& objs = m_map.GetObjects(x, y);
-	    for (auto itr = objs.begin(), e = objs.end(); itr != e; ++itr){
-		if (itr->GetRemoveFlag()){
-		    s = std::make_tuple(itr->GetId(), x, y);
+	    for (const ObjectSlot slot : m_map.GetSlots(x, y)){
+		if (m_map.GetRemoveFlag(slot)){
+		    s = std::make_tuple(m_map.GetId(slot), x, y);
 		    objsRemoveSchedule.emplace_back(s);
 		}
 	    }
 	}
     }
     for (auto& [obj_id, x, y] : objsRemoveSchedule){
-	Object& obj = m_map.GetObject(obj_id, x, y);
-	m_map.RemoveObject(x, y, obj);
+	const ObjectSlot slot = m_map.FindSlot(obj_id, x, y);
+	if (m_isRecordingEvents){
+	    StepEvent event;
+	    event.type = StepEventType::REMOVED;
+	    event.id = obj_id;
+	    event.objectType = m_map.GetType(slot);
+	    event.x = static_cast<std::uint16_t>(x);
+	    event.y = static_cast<std::uint16_t>(y);
+	    m_events.emplace_back(event);
+	}
+	m_map.RemoveObject(slot);
+    }
+    if (!objsRemoveSchedule.empty()){
+	m_moveResolver.Invalidate();
     }
 }
 
@@ -615,16 +854,17 @@ void Game::ResolveAllMoveFlags(){
     int _y;
     const std::size_t width = m_map.GetWidth();
     const std::size_t height = m_map.GetHeight();
+    if (m_isProfiling){
+	m_profile.AddCount(GameCounter::OBJECTS_SCANNED, m_map.GetNumObjects());
+    }
 
     std::vector<std::tuple<ObjectId, size_t, size_t, Direction>> objsMoveSchedule;
     std::tuple<ObjectId, size_t, size_t, Direction> s;
 
     for (std::size_t y = 0; y < height; ++y){
         for (std::size_t x = 0; x < width; ++x){
-	    ObjectContainer& objs = m_map.GetObjects(x, y);
-
-	    for (auto itr = objs.begin(), e = objs.end(); itr != e; ++itr){
-		Direction dir = itr->GetMoveFlag();
+	    for (const ObjectSlot slot : m_map.GetSlots(x, y)){
+		Direction dir = m_map.GetMoveFlag(slot);
 		if (dir != Direction::NONE){
 		    // std::cout << "ResolveAllMoveFlags" << std::endl;
 		    // std::cout << static_cast<int>(itr->GetType()) << " "
@@ -633,19 +873,31 @@ void Game::ResolveAllMoveFlags(){
 		    // 	      << y << " "
 		    // 	      << std::endl;
 
-		    itr->SetMoveFlag(Direction::NONE);
-		    s = std::make_tuple(itr->GetId(), x, y, dir);
+		    m_map.SetMoveFlag(slot, Direction::NONE);
+		    s = std::make_tuple(m_map.GetId(slot), x, y, dir);
 		    objsMoveSchedule.emplace_back(s);
 		}
 	    }
         }
     }
     for (auto& [obj_id, x, y, dir] : objsMoveSchedule){
-	Object& obj = m_map.GetObject(obj_id, x, y);
+	const ObjectSlot slot = m_map.FindSlot(obj_id, x, y);
 	std::tie(_x, _y) = GetPositionAfterMove(x, y, dir);
-	if (CanMove(x, y, dir, obj)){
-	    m_map.AddObject(_x, _y, obj);
-	    m_map.RemoveObject(x, y, obj);
+	if (CanMove(x, y, dir)){
+	    if (m_isRecordingEvents){
+		StepEvent event;
+		event.type = StepEventType::MOVED;
+		event.id = obj_id;
+		event.objectType = m_map.GetType(slot);
+		event.x = static_cast<std::uint16_t>(x);
+		event.y = static_cast<std::uint16_t>(y);
+		event.toX = static_cast<std::uint16_t>(_x);
+		event.toY = static_cast<std::uint16_t>(_y);
+		m_events.emplace_back(event);
+	    }
+	    m_map.MoveObject(slot, _x, _y);
+	    // Later objects check their moves on the map after this move.
+	    m_moveResolver.NotifyMoved(m_ruleManager, m_map.GetType(slot));
 	}
     }
 
@@ -0,0 +1,160 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <baba-is-auto/Games/GameProfile.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace baba_is_auto
+{
+namespace
+{
+//! Gets the index of the highest set bit of \p word.
+//! \param word The word that is not zero.
+//! \return The index of the highest set bit.
+int GetHighestBit(std::uint64_t word)
+{
+#ifdef _MSC_VER
+    unsigned long idx = 0;
+    _BitScanReverse64(&idx, word);
+    return static_cast<int>(idx);
+#else
+    return 63 - __builtin_clzll(word);
+#endif
+}
+}  // namespace
+
+void GameProfile::Enable()
+{
+    if (!IsEnabled())
+    {
+        m_numCalls.assign(NUM_PHASES, 0);
+        m_totalNanoseconds.assign(NUM_PHASES, 0);
+        m_histograms.assign(NUM_PHASES * NUM_BUCKETS, 0);
+        m_counters.assign(NUM_COUNTERS, 0);
+    }
+}
+
+bool GameProfile::IsEnabled() const
+{
+    return !m_counters.empty();
+}
+
+void GameProfile::Reset()
+{
+    std::fill(m_numCalls.begin(), m_numCalls.end(), 0);
+    std::fill(m_totalNanoseconds.begin(), m_totalNanoseconds.end(), 0);
+    std::fill(m_histograms.begin(), m_histograms.end(), 0);
+    std::fill(m_counters.begin(), m_counters.end(), 0);
+}
+
+void GameProfile::AddPhaseTime(GamePhase phase, std::uint64_t nanoseconds)
+{
+    const auto idx = static_cast<std::size_t>(phase);
+
+    ++m_numCalls[idx];
+    m_totalNanoseconds[idx] += nanoseconds;
+    ++m_histograms[idx * NUM_BUCKETS + ToBucket(nanoseconds)];
+}
+
+std::uint64_t GameProfile::GetNumCalls(GamePhase phase) const
+{
+    return IsEnabled() ? m_numCalls[static_cast<std::size_t>(phase)] : 0;
+}
+
+std::uint64_t GameProfile::GetTotalNanoseconds(GamePhase phase) const
+{
+    return IsEnabled() ? m_totalNanoseconds[static_cast<std::size_t>(phase)]
+                       : 0;
+}
+
+double GameProfile::GetMeanNanoseconds(GamePhase phase) const
+{
+    const std::uint64_t numCalls = GetNumCalls(phase);
+    if (numCalls == 0)
+    {
+        return 0.0;
+    }
+
+    return static_cast<double>(GetTotalNanoseconds(phase)) /
+           static_cast<double>(numCalls);
+}
+
+double GameProfile::GetPercentileNanoseconds(GamePhase phase,
+                                             double percentile) const
+{
+    const std::uint64_t numCalls = GetNumCalls(phase);
+    if (numCalls == 0)
+    {
+        return 0.0;
+    }
+
+    // The rank of the call at the percentile, from 1 to numCalls.
+    const double clamped = std::min(std::max(percentile, 0.0), 100.0);
+    const auto rank = std::max<std::uint64_t>(
+        static_cast<std::uint64_t>(
+            std::ceil(clamped / 100.0 * static_cast<double>(numCalls))),
+        1);
+
+    const std::uint64_t* histogram =
+        m_histograms.data() + static_cast<std::size_t>(phase) * NUM_BUCKETS;
+    std::uint64_t numBelow = 0;
+    for (std::size_t bucket = 0; bucket < NUM_BUCKETS; ++bucket)
+    {
+        numBelow += histogram[bucket];
+        if (numBelow >= rank)
+        {
+            return GetBucketMiddle(bucket);
+        }
+    }
+
+    return GetBucketMiddle(NUM_BUCKETS - 1);
+}
+
+std::uint64_t GameProfile::GetCount(GameCounter counter) const
+{
+    return IsEnabled() ? m_counters[static_cast<std::size_t>(counter)] : 0;
+}
+
+std::size_t GameProfile::ToBucket(std::uint64_t nanoseconds)
+{
+    if (nanoseconds < 8)
+    {
+        return static_cast<std::size_t>(nanoseconds);
+    }
+
+    // The times of 2^40 ns or more share the last bucket.
+    const std::uint64_t maxNanoseconds = (std::uint64_t{ 1 } << 40) - 1;
+    nanoseconds = std::min(nanoseconds, maxNanoseconds);
+
+    // The highest bit picks the power of two and the 3 bits below it pick
+    // one of its 8 buckets.
+    const int highestBit = GetHighestBit(nanoseconds);
+    const auto subBucket =
+        static_cast<std::size_t>((nanoseconds >> (highestBit - 3)) & 7);
+
+    return static_cast<std::size_t>(highestBit - 2) * 8 + subBucket;
+}
+
+double GameProfile::GetBucketMiddle(std::size_t bucket)
+{
+    if (bucket < 8)
+    {
+        return static_cast<double>(bucket);
+    }
+
+    const std::size_t highestBit = bucket / 8 + 2;
+    const std::size_t subBucket = bucket % 8;
+    const double width = std::ldexp(1.0, static_cast<int>(highestBit) - 3);
+
+    return static_cast<double>(8 + subBucket) * width + width / 2.0;
+}
+}  // namespace baba_is_auto
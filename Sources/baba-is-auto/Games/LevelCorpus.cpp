@@ -0,0 +1,115 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <baba-is-auto/Games/LevelCorpus.hpp>
+
+#include <cstring>
+#include <stdexcept>
+
+namespace baba_is_auto
+{
+LevelCorpus::LevelCorpus(std::string_view filename) : m_file(filename)
+{
+    const std::uint8_t* data = m_file.GetData();
+    const std::size_t size = m_file.GetSize();
+
+    CorpusHeader header{};
+    if (size < sizeof(CorpusHeader))
+    {
+        throw std::invalid_argument("LevelCorpus - The file is not a corpus.");
+    }
+
+    std::memcpy(&header, data, sizeof(CorpusHeader));
+    if (std::memcmp(header.magic, CORPUS_MAGIC, sizeof(CORPUS_MAGIC)) != 0)
+    {
+        throw std::invalid_argument("LevelCorpus - The file is not a corpus.");
+    }
+    if (header.version != LEVEL_FORMAT_VERSION)
+    {
+        throw std::invalid_argument(
+            "LevelCorpus - The version of the corpus is not supported.");
+    }
+
+    m_numLevels = header.numLevels;
+    if ((size - sizeof(CorpusHeader)) / sizeof(CorpusEntry) < m_numLevels)
+    {
+        throw std::invalid_argument("LevelCorpus - The corpus is truncated.");
+    }
+
+    for (std::size_t idx = 0; idx < m_numLevels; ++idx)
+    {
+        const CorpusEntry entry = GetEntry(idx);
+        if (entry.offset > size || entry.size > size - entry.offset ||
+            entry.nameOffset > size ||
+            entry.nameLength > size - entry.nameOffset)
+        {
+            throw std::invalid_argument(
+                "LevelCorpus - The corpus is truncated.");
+        }
+    }
+}
+
+std::size_t LevelCorpus::GetNumLevels() const
+{
+    return m_numLevels;
+}
+
+std::string_view LevelCorpus::GetName(std::size_t idx) const
+{
+    const CorpusEntry entry = GetEntry(idx);
+
+    return std::string_view(
+        reinterpret_cast<const char*>(m_file.GetData() + entry.nameOffset),
+        entry.nameLength);
+}
+
+std::size_t LevelCorpus::FindLevel(std::string_view name) const
+{
+    for (std::size_t idx = 0; idx < m_numLevels; ++idx)
+    {
+        if (GetName(idx) == name)
+        {
+            return idx;
+        }
+    }
+
+    return m_numLevels;
+}
+
+const std::uint8_t* LevelCorpus::GetLevelData(std::size_t idx) const
+{
+    return m_file.GetData() + GetEntry(idx).offset;
+}
+
+std::size_t LevelCorpus::GetLevelSize(std::size_t idx) const
+{
+    return static_cast<std::size_t>(GetEntry(idx).size);
+}
+
+void LevelCorpus::LoadMap(std::size_t idx, Map& map) const
+{
+    const CorpusEntry entry = GetEntry(idx);
+
+    map.LoadLevel(m_file.GetData() + entry.offset,
+                  static_cast<std::size_t>(entry.size));
+}
+
+CorpusEntry LevelCorpus::GetEntry(std::size_t idx) const
+{
+    if (idx >= m_numLevels)
+    {
+        throw std::out_of_range("LevelCorpus - The index is out of range.");
+    }
+
+    CorpusEntry entry{};
+    std::memcpy(&entry,
+                m_file.GetData() + sizeof(CorpusHeader) +
+                    idx * sizeof(CorpusEntry),
+                sizeof(CorpusEntry));
+
+    return entry;
+}
+}  // namespace baba_is_auto
@@ -0,0 +1,130 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <baba-is-auto/Games/LevelFormat.hpp>
+#include <baba-is-auto/Games/Map.hpp>
+
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+namespace baba_is_auto
+{
+bool IsLevelData(const std::uint8_t* data, std::size_t size)
+{
+    return size >= sizeof(LEVEL_MAGIC) &&
+           std::memcmp(data, LEVEL_MAGIC, sizeof(LEVEL_MAGIC)) == 0;
+}
+
+ByteBuffer EncodeLevel(const Map& map)
+{
+    const std::size_t width = map.GetWidth();
+    const std::size_t height = map.GetHeight();
+    constexpr std::size_t maxSize = std::numeric_limits<std::uint16_t>::max();
+    if (width > maxSize || height > maxSize)
+    {
+        throw std::invalid_argument("LevelFormat - The map is too large.");
+    }
+
+    std::vector<std::uint32_t> offsets;
+    std::vector<LevelObject> objects;
+    offsets.reserve(width * height + 1);
+    offsets.emplace_back(0);
+
+    for (std::size_t y = 0; y < height; ++y)
+    {
+        for (std::size_t x = 0; x < width; ++x)
+        {
+            for (const ObjectSlot slot : map.GetSlots(x, y))
+            {
+                objects.push_back(
+                    { static_cast<std::uint8_t>(map.GetType(slot)),
+                      static_cast<std::uint8_t>(map.GetDirection(slot)) });
+            }
+            offsets.emplace_back(static_cast<std::uint32_t>(objects.size()));
+        }
+    }
+
+    LevelHeader header{};
+    std::memcpy(header.magic, LEVEL_MAGIC, sizeof(LEVEL_MAGIC));
+    header.version = LEVEL_FORMAT_VERSION;
+    header.width = static_cast<std::uint16_t>(width);
+    header.height = static_cast<std::uint16_t>(height);
+    header.numObjects = static_cast<std::uint32_t>(objects.size());
+
+    ByteBuffer out;
+    out.reserve(sizeof(LevelHeader) + offsets.size() * sizeof(std::uint32_t) +
+                objects.size() * sizeof(LevelObject));
+
+    WriteBytes(out, header);
+    for (const std::uint32_t offset : offsets)
+    {
+        WriteBytes(out, offset);
+    }
+    for (const LevelObject& object : objects)
+    {
+        WriteBytes(out, object);
+    }
+
+    return out;
+}
+
+ByteBuffer EncodeCorpus(const std::vector<std::string>& names,
+                        const std::vector<ByteBuffer>& levels)
+{
+    if (names.size() != levels.size())
+    {
+        throw std::invalid_argument(
+            "LevelFormat - The number of names must match the number of "
+            "levels.");
+    }
+
+    CorpusHeader header{};
+    std::memcpy(header.magic, CORPUS_MAGIC, sizeof(CORPUS_MAGIC));
+    header.version = LEVEL_FORMAT_VERSION;
+    header.numLevels = static_cast<std::uint32_t>(levels.size());
+
+    // Names go right after the entries, then the levels.
+    std::uint64_t offset =
+        sizeof(CorpusHeader) + levels.size() * sizeof(CorpusEntry);
+    std::vector<CorpusEntry> entries(levels.size());
+
+    for (std::size_t idx = 0; idx < names.size(); ++idx)
+    {
+        entries[idx].nameOffset = offset;
+        entries[idx].nameLength = static_cast<std::uint32_t>(names[idx].size());
+        offset += names[idx].size();
+    }
+    for (std::size_t idx = 0; idx < levels.size(); ++idx)
+    {
+        // Levels start on 8 bytes, so their offsets can be read in place.
+        offset = (offset + 7) & ~std::uint64_t{ 7 };
+        entries[idx].offset = offset;
+        entries[idx].size = levels[idx].size();
+        offset += levels[idx].size();
+    }
+
+    ByteBuffer out;
+    out.reserve(static_cast<std::size_t>(offset));
+
+    WriteBytes(out, header);
+    for (const CorpusEntry& entry : entries)
+    {
+        WriteBytes(out, entry);
+    }
+    for (const std::string& name : names)
+    {
+        out.insert(out.end(), name.begin(), name.end());
+    }
+    for (std::size_t idx = 0; idx < levels.size(); ++idx)
+    {
+        out.resize(static_cast<std::size_t>(entries[idx].offset), 0);
+        out.insert(out.end(), levels[idx].begin(), levels[idx].end());
+    }
+
+    return out;
+}
+}  // namespace baba_is_auto
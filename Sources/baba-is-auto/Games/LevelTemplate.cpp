@@ -0,0 +1,48 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <baba-is-auto/Games/LevelTemplate.hpp>
+
+#include <utility>
+
+namespace baba_is_auto
+{
+LevelTemplate::LevelTemplate(std::string_view filename)
+{
+    m_map.Load(filename);
+    Init();
+}
+
+LevelTemplate::LevelTemplate(const LevelCorpus& corpus, std::size_t idx)
+{
+    corpus.LoadMap(idx, m_map);
+    Init();
+}
+
+LevelTemplate::LevelTemplate(Map map) : m_map(std::move(map))
+{
+    Init();
+}
+
+const Map& LevelTemplate::GetMap() const
+{
+    return m_map;
+}
+
+const RuleManager& LevelTemplate::GetRuleManager() const
+{
+    return m_ruleManager;
+}
+
+void LevelTemplate::Init()
+{
+    // The rule flags of the squares are a part of the initial state, so a
+    // game made from the template does not parse the rules again.
+    m_ruleManager.ParseRules(m_map);
+    m_map.SaveInitState();
+    m_map.MarkAllCellsDirty();
+}
+}  // namespace baba_is_auto
@@ -4,133 +4,1011 @@
 // personal capacity and am not conveying any rights to any intellectual
 // property of any third parties.
 
+#include <baba-is-auto/Games/LevelFormat.hpp>
 #include <baba-is-auto/Games/Map.hpp>
+#include <baba-is-auto/Utils/Trace.hpp>
 
+#include <algorithm>
+#include <cstring>
 #include <fstream>
+#include <iterator>
+#include <stdexcept>
 
 namespace baba_is_auto
 {
+namespace
+{
+//! Gets the Zobrist key of an object, mixing its square, type and direction
+//! with SplitMix64 instead of looking them up in a table of random numbers.
+std::uint64_t GetObjectKey(std::uint32_t cell, ObjectType type, Direction dir)
+{
+    std::uint64_t key = (static_cast<std::uint64_t>(cell) << 16) |
+                        (static_cast<std::uint64_t>(type) << 8) |
+                        static_cast<std::uint64_t>(dir);
+
+    key += 0x9e3779b97f4a7c15ULL;
+    key = (key ^ (key >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    key = (key ^ (key >> 27)) * 0x94d049bb133111ebULL;
+    return key ^ (key >> 31);
+}
+
+//! Checks \p type is the type of an object, not the start of a section.
+bool IsObjectType(ObjectType type)
+{
+    return IsIconType(type) ||
+           (IsTextType(type) && type != ObjectType::NOUN_TYPE &&
+            type != ObjectType::OP_TYPE && type != ObjectType::PROPERTY_TYPE);
+}
+}  // namespace
+
 Map::Map(std::size_t width, std::size_t height)
     : m_width(width), m_height(height)
 {
-    m_initSquares.reserve(m_width * m_height);
-    m_squares.reserve(m_width * m_height);
-
-    // for (std::size_t i = 0; i < m_width * m_height; ++i)
-    // {
-    // 	std::cout <<  "Square sq = Square();"  << std::endl;
+    const std::size_t numCells = m_width * m_height;
+    m_numWords = (numCells + 63) / 64;
+    m_state.cellRanges.assign(numCells, CellRange());
+    m_state.ruleFlags.assign(numCells, 0);
+    m_state.bitboards.assign(NUM_BITBOARDS * m_numWords, 0);
 
-    // 	Square sq = Square();
+    for (std::size_t cell = 0; cell < numCells; ++cell)
+    {
+        FillEmptyCell(static_cast<std::uint32_t>(cell));
+    }
 
-    // 	std::cout <<  "m_initSquares.emplace_back(sq);"  << std::endl;
-    // 	m_initSquares.emplace_back(sq);
-    // 	m_squares.emplace_back(Square(sq));
-    //     // m_initObjects.emplace_back(
-    //     //     std::vector<ObjectType>{ ObjectType::ICON_EMPTY });
-    //     // m_objects.emplace_back(
-    //     //     std::vector<ObjectType>{ ObjectType::ICON_EMPTY });
-    // }
+    MarkAllLinesDirty();
+    MarkAllCellsDirty();
+    SaveInitState();
 }
 
 void Map::Load(std::string_view filename)
 {
-    std::ifstream mapFile(filename.data());
+    std::ifstream mapFile(filename.data(), std::ios::binary);
+
+    char magic[sizeof(LEVEL_MAGIC)] = {};
+    mapFile.read(magic, sizeof(magic));
+    if (mapFile &&
+        std::memcmp(magic, LEVEL_MAGIC, sizeof(LEVEL_MAGIC)) == 0)
+    {
+        mapFile.seekg(0);
+        const ByteBuffer level((std::istreambuf_iterator<char>(mapFile)),
+                               std::istreambuf_iterator<char>());
+        LoadLevel(level.data(), level.size());
+        return;
+    }
 
+    mapFile.clear();
+    mapFile.seekg(0);
     mapFile >> m_width >> m_height;
 
+    const std::size_t numCells = m_width * m_height;
+    m_numWords = (numCells + 63) / 64;
+    m_state = State();
+    m_state.cellRanges.assign(numCells, CellRange());
+    m_state.ruleFlags.assign(numCells, 0);
+
     int val = 0;
 
     /* Notes (letra418):
        TODO: load direction?
     */
-    for (std::size_t y = 0; y < m_height; ++y){
-	for (std::size_t x = 0; x < m_width; ++x){
-
+    for (std::size_t cell = 0; cell < numCells; ++cell)
+    {
         mapFile >> val;
 
-	Object obj = Object(static_cast<ObjectType>(val));
-	ObjectContainer init_vector{obj};
-	Square sq = Square(x, y, init_vector);
+        const auto cellIdx = static_cast<std::uint32_t>(cell);
+        const auto begin =
+            static_cast<std::uint32_t>(m_state.cellObjects.size());
+        m_state.cellObjects.emplace_back(
+            AllocateSlot(Object(static_cast<ObjectType>(val)), cellIdx));
+        EndCell(cellIdx, begin);
+    }
+
+    FinishLoad();
+}
 
-	m_initSquares.emplace_back(sq);
-	m_squares.emplace_back(sq);
-        // m_initObjects.emplace_back(
-        //     std::vector<ObjectType>{ static_cast<ObjectType>(val) });
-        // m_objects.emplace_back(
-        //     std::vector<ObjectType>{ static_cast<ObjectType>(val) });
-	}
+void Map::LoadLevel(const std::uint8_t* data, std::size_t size)
+{
+    LevelHeader header{};
+    if (size < sizeof(LevelHeader) || !IsLevelData(data, size))
+    {
+        throw std::invalid_argument("The data is not a level.");
     }
+
+    std::memcpy(&header, data, sizeof(LevelHeader));
+    if (header.version != LEVEL_FORMAT_VERSION)
+    {
+        throw std::invalid_argument("The version of the level is not supported.");
+    }
+
+    const std::size_t numCells =
+        static_cast<std::size_t>(header.width) * header.height;
+    const std::size_t offsetsSize = (numCells + 1) * sizeof(std::uint32_t);
+    if (size - sizeof(LevelHeader) < offsetsSize ||
+        (size - sizeof(LevelHeader) - offsetsSize) / sizeof(LevelObject) <
+            header.numObjects)
+    {
+        throw std::invalid_argument("The level is truncated.");
+    }
+
+    const std::uint8_t* offsets = data + sizeof(LevelHeader);
+    const std::uint8_t* objects = offsets + offsetsSize;
+
+    const auto GetOffset = [offsets](std::size_t cell) {
+        std::uint32_t offset = 0;
+        std::memcpy(&offset, offsets + cell * sizeof(std::uint32_t),
+                    sizeof(std::uint32_t));
+        return offset;
+    };
+    const auto GetLevelObject = [objects](std::size_t idx) {
+        LevelObject object{};
+        std::memcpy(&object, objects + idx * sizeof(LevelObject),
+                    sizeof(LevelObject));
+        return object;
+    };
+
+    // Check everything before the map is touched, so a bad level leaves the
+    // map as it was.
+    if (GetOffset(0) != 0 || GetOffset(numCells) != header.numObjects)
+    {
+        throw std::invalid_argument("The offsets of the level are invalid.");
+    }
+    for (std::size_t cell = 0; cell < numCells; ++cell)
+    {
+        if (GetOffset(cell) > GetOffset(cell + 1))
+        {
+            throw std::invalid_argument(
+                "The offsets of the level are invalid.");
+        }
+    }
+    for (std::size_t idx = 0; idx < header.numObjects; ++idx)
+    {
+        const LevelObject object = GetLevelObject(idx);
+        if (!IsObjectType(static_cast<ObjectType>(object.type)) ||
+            object.direction > static_cast<std::uint8_t>(Direction::RIGHT))
+        {
+            throw std::invalid_argument("The level has an invalid object.");
+        }
+    }
+
+    m_width = header.width;
+    m_height = header.height;
+    m_numWords = (numCells + 63) / 64;
+    m_state = State();
+    m_state.cellRanges.assign(numCells, CellRange());
+    m_state.ruleFlags.assign(numCells, 0);
+
+    for (std::size_t cell = 0; cell < numCells; ++cell)
+    {
+        const auto cellIdx = static_cast<std::uint32_t>(cell);
+        const auto begin =
+            static_cast<std::uint32_t>(m_state.cellObjects.size());
+
+        for (std::size_t idx = GetOffset(cell); idx < GetOffset(cell + 1);
+             ++idx)
+        {
+            const LevelObject object = GetLevelObject(idx);
+            m_state.cellObjects.emplace_back(AllocateSlot(
+                Object(static_cast<ObjectType>(object.type),
+                       static_cast<Direction>(object.direction)),
+                cellIdx));
+        }
+
+        // An empty square keeps a placeholder, as FillEmptyCell does.
+        if (GetOffset(cell) == GetOffset(cell + 1))
+        {
+            m_state.cellObjects.emplace_back(
+                AllocateSlot(Object(ObjectType::ICON_EMPTY), cellIdx));
+        }
+
+        EndCell(cellIdx, begin);
+    }
+
+    FinishLoad();
 }
 
 void Map::Reset()
 {
-    m_squares = m_initSquares;
+    if (m_initState)
+    {
+        m_state = *m_initState;
+    }
+
+    MarkAllCellsDirty();
+}
+
+void Map::SaveInitState()
+{
+    m_initState = std::make_shared<const State>(m_state);
+}
+
+bool Map::SharesInitState(const Map& other) const
+{
+    return m_initState == other.m_initState;
 }
 
 void Map::AddObject(std::size_t x, std::size_t y, const Object& obj)
 {
-    m_squares.at(y * m_width + x).AddObject(obj);
+    const auto cell = static_cast<std::uint32_t>(ToCell(x, y));
+
+    const ObjectSlot slot = AllocateSlot(obj, cell);
+
+    BABA_TRACE(TraceLevel::VERBOSE, TraceCategory::MAP,
+               "<AddObject> (obj_id, x, y, obj_type) = ", slot,
+               " ", x, " ", y, " ", static_cast<int>(obj.GetType()));
+
+    LinkSlot(cell, slot);
+    RemoveAllByType(cell, ObjectType::ICON_EMPTY);
 }
 
 void Map::RemoveObject(std::size_t x, std::size_t y, const Object& obj)
 {
-    m_squares.at(y * m_width + x).RemoveObject(obj);
+    const ObjectSlot slot = FindSlot(obj.GetId(), x, y);
+    if (m_state.types[slot] != obj.GetType())
+    {
+        throw std::invalid_argument(
+            "The object to be removed is not found in the map.");
+    }
+
+    RemoveObject(slot);
 }
 
+void Map::RemoveObject(ObjectSlot slot)
+{
+    const std::uint32_t cell = m_state.cells[slot];
 
-Square& Map::At(std::size_t x, std::size_t y)
+    BABA_TRACE(TraceLevel::VERBOSE, TraceCategory::MAP,
+               "<RemoveObject> (obj_id, x, y, obj_type) = ", slot,
+               " ", cell % m_width, " ", cell / m_width, " ",
+               static_cast<int>(m_state.types[slot]));
+
+    UnlinkSlot(cell, slot);
+    FreeSlot(slot);
+    FillEmptyCell(cell);
+}
+
+void Map::MoveObject(ObjectSlot slot, std::size_t x, std::size_t y)
 {
-    return m_squares.at(y * m_width + x);
+    const std::uint32_t srcCell = m_state.cells[slot];
+    const auto dstCell = static_cast<std::uint32_t>(ToCell(x, y));
+
+    BABA_TRACE(TraceLevel::VERBOSE, TraceCategory::MAP,
+               "<MoveObject> (obj_id, x, y, obj_type) = ", slot,
+               " ", x, " ", y, " ", static_cast<int>(m_state.types[slot]));
+
+    UnlinkSlot(srcCell, slot);
+    m_state.cells[slot] = dstCell;
+    LinkSlot(dstCell, slot);
+
+    // Same as adding the object to the destination and removing it from the
+    // source: the destination loses its placeholders, the source may get one.
+    RemoveAllByType(dstCell, ObjectType::ICON_EMPTY);
+    FillEmptyCell(srcCell);
 }
 
-const Square& Map::At(std::size_t x, std::size_t y) const
+Square Map::At(std::size_t x, std::size_t y) const
 {
-    return m_squares.at(y * m_width + x);
+    Square square(x, y, GetObjects(x, y));
+    square.isRule = IsRule(x, y);
+
+    return square;
 }
 
-Object& Map::GetObject(ObjectId obj_id, std::size_t x, std::size_t y){
-    Square& square = At(x, y);
-    ObjectContainer& objs = square.GetObjects();
-    for (auto itr = objs.begin(), e = objs.end(); itr != e; ++itr){ 
-	if (itr->GetId() == obj_id){
-	    size_t index = std::distance(objs.begin(), itr);
-	    Object& obj = objs.at(index); 
-	    return obj;
-	}
+SlotRange Map::GetSlots(std::size_t x, std::size_t y) const
+{
+    return GetCellSlots(static_cast<std::uint32_t>(ToCell(x, y)));
+}
+
+ObjectSlot Map::GetSlot(ObjectId objId) const
+{
+    if (objId >= m_state.cells.size() || m_state.cells[objId] == INVALID_CELL)
+    {
+        return INVALID_SLOT;
     }
-    std::cout << "Exception: the object was not found (Id, x, y) =  "
-	      << obj_id << " "
-	      << x << " "
-	      << y << " "
-	      << std::endl;
 
-    std::exit(EXIT_FAILURE);
+    return static_cast<ObjectSlot>(objId);
 }
 
-const ObjectContainer& Map::GetObjects(std::size_t x, std::size_t y) const {
-    const ObjectContainer& objs = At(x, y).GetObjects();
-    return objs;
+ObjectSlot Map::FindSlot(ObjectId objId, std::size_t x, std::size_t y) const
+{
+    const ObjectSlot slot = GetSlot(objId);
+    if (slot == INVALID_SLOT || m_state.cells[slot] != ToCell(x, y))
+    {
+        throw std::invalid_argument("The object is not found in the map.");
+    }
+
+    return slot;
+}
+
+Object Map::GetObject(ObjectSlot slot) const
+{
+    Object obj(m_state.types[slot], m_state.directions[slot], GetId(slot));
+    obj.SetMoveFlag(m_state.moveFlags[slot]);
+    obj.SetRemoveFlag(m_state.removeFlags[slot] != 0);
+    obj.SetChangeFlag(m_state.changeFlags[slot]);
+
+    return obj;
 }
 
-ObjectContainer& Map::GetObjects(std::size_t x, std::size_t y){
-    ObjectContainer& objs = At(x, y).GetObjects();
+ObjectContainer Map::GetObjects(std::size_t x, std::size_t y) const
+{
+    ObjectContainer objs;
+
+    for (const ObjectSlot slot : GetSlots(x, y))
+    {
+        objs.emplace_back(GetObject(slot));
+    }
+
     return objs;
 }
 
+void Map::SetType(ObjectSlot slot, ObjectType type)
+{
+    const ObjectType prevType = m_state.types[slot];
+    m_state.types[slot] = type;
+
+    const std::uint32_t cell = m_state.cells[slot];
+    const Direction dir = m_state.directions[slot];
+    m_state.hash += GetObjectKey(cell, type, dir) -
+                    GetObjectKey(cell, prevType, dir);
+
+    UpdateBitboard(cell, prevType);
+    UpdateBitboard(cell, type);
+    MarkDirtyCell(cell);
+
+    if (!IsIconType(prevType) || !IsIconType(type))
+    {
+        MarkDirtyLines(cell);
+    }
+}
+
+void Map::SetDirection(ObjectSlot slot, Direction dir)
+{
+    const Direction prevDir = m_state.directions[slot];
+    m_state.directions[slot] = dir;
+
+    const std::uint32_t cell = m_state.cells[slot];
+    const ObjectType type = m_state.types[slot];
+    m_state.hash +=
+        GetObjectKey(cell, type, dir) - GetObjectKey(cell, type, prevDir);
+}
+
+std::uint64_t Map::ComputeHash() const
+{
+    std::uint64_t hash = 0;
+
+    for (std::size_t cell = 0; cell < m_state.cellRanges.size(); ++cell)
+    {
+        const auto cellIdx = static_cast<std::uint32_t>(cell);
+        for (const ObjectSlot slot : GetCellSlots(cellIdx))
+        {
+            hash += GetObjectKey(cellIdx, m_state.types[slot],
+                                 m_state.directions[slot]);
+        }
+    }
+
+    return hash;
+}
+
+bool Map::IsRule(std::size_t x, std::size_t y) const
+{
+    return m_state.ruleFlags[ToCell(x, y)] != 0;
+}
+
+void Map::SetRule(std::size_t x, std::size_t y, RuleDirection direction,
+                  bool flag)
+{
+    const auto bit =
+        static_cast<std::uint8_t>(1u << static_cast<int>(direction));
+    const auto cell = static_cast<std::uint32_t>(ToCell(x, y));
+    std::uint8_t& ruleFlag = m_state.ruleFlags[cell];
+
+    const std::uint8_t prevFlag = ruleFlag;
+    ruleFlag = flag ? (ruleFlag | bit) : (ruleFlag & ~bit);
+
+    if ((prevFlag != 0) != (ruleFlag != 0))
+    {
+        MarkDirtyCell(cell);
+    }
+}
+
+bool Map::HasDirtyLines() const
+{
+    return m_state.hasDirtyLines;
+}
+
+bool Map::IsDirtyRow(std::size_t y) const
+{
+    return m_state.dirtyRows[y] != 0;
+}
+
+bool Map::IsDirtyColumn(std::size_t x) const
+{
+    return m_state.dirtyColumns[x] != 0;
+}
+
+void Map::MarkAllLinesDirty()
+{
+    m_state.dirtyRows.assign(m_height, 1);
+    m_state.dirtyColumns.assign(m_width, 1);
+    m_state.hasDirtyLines = true;
+}
+
+void Map::ClearDirtyLines()
+{
+    m_state.dirtyRows.assign(m_height, 0);
+    m_state.dirtyColumns.assign(m_width, 0);
+    m_state.hasDirtyLines = false;
+}
+
+const std::vector<std::uint32_t>& Map::GetDirtyCells() const
+{
+    return m_dirtyCells;
+}
 
-// bool Map::HasTextType(std::size_t x, std::size_t y) const
-// {
-//     for (auto& obj : At(x, y).GetObjects())
-//     {
-//         if (!IsIconType(obj.GetType()))
-//         {
-//             return true;
-//         }
-//     }
-//     return false;
-// }
+bool Map::AreAllCellsDirty() const
+{
+    return m_allCellsDirty;
+}
 
+void Map::MarkAllCellsDirty()
+{
+    m_dirtyCells.clear();
+    m_allCellsDirty = true;
+}
 
+void Map::ClearDirtyCells()
+{
+    if (m_allCellsDirty)
+    {
+        m_dirtyCellFlags.assign(m_width * m_height, 0);
+        m_allCellsDirty = false;
+    }
+    else
+    {
+        for (const std::uint32_t cell : m_dirtyCells)
+        {
+            m_dirtyCellFlags[cell] = 0;
+        }
+    }
 
+    m_dirtyCells.clear();
+}
 
+bool Map::HasTextType(std::size_t x, std::size_t y) const
+{
+    for (const ObjectSlot slot : GetSlots(x, y))
+    {
+        if (!IsIconType(m_state.types[slot]))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+std::size_t Map::GetNumObjects() const
+{
+    return m_state.cells.size() - m_state.freeSlots.size();
+}
+
+std::size_t Map::GetNumObjectIds() const
+{
+    return m_state.cells.size();
+}
+
+void Map::WriteState(ByteBuffer& out) const
+{
+    const State& s = m_state;
+
+    WriteBytes(out, static_cast<std::uint64_t>(m_width));
+    WriteBytes(out, static_cast<std::uint64_t>(m_height));
+
+    WriteBytes(out, s.types);
+    WriteBytes(out, s.directions);
+    WriteBytes(out, s.moveFlags);
+    WriteBytes(out, s.changeFlags);
+    WriteBytes(out, s.removeFlags);
+    WriteBytes(out, s.cells);
+    WriteBytes(out, s.freeSlots);
+    WriteBytes(out, s.cellRanges);
+    WriteBytes(out, s.cellObjects);
+    WriteBytes(out, s.numUnusedObjects);
+    WriteBytes(out, s.ruleFlags);
+
+    // The dirty lines are cleared after each step, so they are written only
+    // when the map was changed outside of a step. The bitboards could be
+    // built from the objects, but copying them is faster.
+    WriteBytes(out, s.hasDirtyLines);
+    if (s.hasDirtyLines)
+    {
+        WriteBytes(out, s.dirtyRows);
+        WriteBytes(out, s.dirtyColumns);
+    }
+    WriteBytes(out, s.hash);
+    WriteBytes(out, s.bitboards);
+}
+
+void Map::CheckState(const std::uint8_t*& in, const std::uint8_t* end) const
+{
+    const std::size_t numCells = m_width * m_height;
+
+    std::uint64_t width = 0, height = 0;
+    ReadBytes(in, end, width);
+    ReadBytes(in, end, height);
+    if (width != m_width || height != m_height)
+    {
+        throw std::invalid_argument("The state is not of a map of this size.");
+    }
+
+    const auto types = ReadBytesView<ObjectType>(in, end);
+    const auto directions = ReadBytesView<Direction>(in, end);
+    const auto moveFlags = ReadBytesView<Direction>(in, end);
+    const auto changeFlags = ReadBytesView<ObjectType>(in, end);
+    const auto removeFlags = ReadBytesView<std::uint8_t>(in, end);
+    const auto cells = ReadBytesView<std::uint32_t>(in, end);
+    const auto freeSlots = ReadBytesView<ObjectSlot>(in, end);
+    const auto cellRanges = ReadBytesView<CellRange>(in, end);
+    const auto cellObjects = ReadBytesView<ObjectSlot>(in, end);
+    std::uint32_t numUnusedObjects = 0;
+    ReadBytes(in, end, numUnusedObjects);
+    const auto ruleFlags = ReadBytesView<std::uint8_t>(in, end);
+    std::uint8_t hasDirtyLines = 0;
+    ReadBytes(in, end, hasDirtyLines);
+    if (hasDirtyLines > 1)
+    {
+        throw std::invalid_argument("The state has invalid dirty lines.");
+    }
+    if (hasDirtyLines)
+    {
+        const auto dirtyRows = ReadBytesView<std::uint8_t>(in, end);
+        const auto dirtyColumns = ReadBytesView<std::uint8_t>(in, end);
+        if (dirtyRows.size() != m_height || dirtyColumns.size() != m_width)
+        {
+            throw std::invalid_argument("The state has invalid dirty lines.");
+        }
+    }
+    std::uint64_t hash = 0;
+    ReadBytes(in, end, hash);
+    const auto bitboards = ReadBytesView<std::uint64_t>(in, end);
+
+    const std::size_t numSlots = cells.size();
+    if (numSlots >= INVALID_SLOT || types.size() != numSlots ||
+        directions.size() != numSlots || moveFlags.size() != numSlots ||
+        changeFlags.size() != numSlots || removeFlags.size() != numSlots)
+    {
+        throw std::invalid_argument("The state has an invalid object pool.");
+    }
+
+    std::size_t numFreeSlots = 0;
+    for (std::size_t slot = 0; slot < numSlots; ++slot)
+    {
+        // Any type is kept as it is, since changes can make objects of
+        // types that a level can not have.
+        if (directions[slot] > Direction::RIGHT ||
+            moveFlags[slot] > Direction::RIGHT || removeFlags[slot] > 1 ||
+            (cells[slot] >= numCells && cells[slot] != INVALID_CELL))
+        {
+            throw std::invalid_argument("The state has an invalid object.");
+        }
+
+        if (cells[slot] == INVALID_CELL)
+        {
+            ++numFreeSlots;
+        }
+    }
+
+    // Bit 0 marks a free slot, bit 1 marks a slot on a square and bit 2
+    // marks an entry of cellObjects in the room of a square.
+    std::vector<std::uint8_t> marks(std::max(numSlots, cellObjects.size()),
+                                    0);
+
+    if (freeSlots.size() != numFreeSlots)
+    {
+        throw std::invalid_argument("The state has invalid free slots.");
+    }
+    for (std::size_t idx = 0; idx < freeSlots.size(); ++idx)
+    {
+        const ObjectSlot slot = freeSlots[idx];
+        if (slot >= numSlots || cells[slot] != INVALID_CELL ||
+            (marks[slot] & 1))
+        {
+            throw std::invalid_argument("The state has invalid free slots.");
+        }
+        marks[slot] |= 1;
+    }
+
+    if (cellRanges.size() != numCells)
+    {
+        throw std::invalid_argument("The state has invalid squares.");
+    }
+
+    std::size_t numLinkedSlots = 0, capacity = 0;
+    for (std::size_t cell = 0; cell < numCells; ++cell)
+    {
+        const CellRange range = cellRanges[cell];
+        if (range.size == 0 || range.size > range.capacity ||
+            range.begin > cellObjects.size() ||
+            range.capacity > cellObjects.size() - range.begin)
+        {
+            throw std::invalid_argument("The state has invalid squares.");
+        }
+
+        for (std::size_t pos = range.begin; pos < range.begin + range.capacity;
+             ++pos)
+        {
+            if (marks[pos] & 4)
+            {
+                throw std::invalid_argument("The state has invalid squares.");
+            }
+            marks[pos] |= 4;
+        }
+
+        for (std::size_t idx = 0; idx < range.size; ++idx)
+        {
+            const ObjectSlot slot = cellObjects[range.begin + idx];
+            if (slot >= numSlots || cells[slot] != cell || (marks[slot] & 2))
+            {
+                throw std::invalid_argument("The state has invalid squares.");
+            }
+            marks[slot] |= 2;
+        }
+
+        numLinkedSlots += range.size;
+        capacity += range.capacity;
+    }
+
+    if (numLinkedSlots != numSlots - numFreeSlots ||
+        numUnusedObjects != cellObjects.size() - capacity)
+    {
+        throw std::invalid_argument("The state has invalid squares.");
+    }
+
+    if (ruleFlags.size() != numCells)
+    {
+        throw std::invalid_argument("The state has invalid rule flags.");
+    }
+    for (std::size_t cell = 0; cell < numCells; ++cell)
+    {
+        if (ruleFlags[cell] > 3)
+        {
+            throw std::invalid_argument("The state has invalid rule flags.");
+        }
+    }
+
+    // The bits after the last square are never set.
+    if (bitboards.size() != NUM_BITBOARDS * m_numWords)
+    {
+        throw std::invalid_argument("The state has invalid bitboards.");
+    }
+    if (numCells % 64 != 0)
+    {
+        const std::uint64_t unusedBits = ~std::uint64_t{ 0 }
+                                         << (numCells % 64);
+        for (std::size_t idx = 0; idx < NUM_BITBOARDS; ++idx)
+        {
+            if (bitboards[(idx + 1) * m_numWords - 1] & unusedBits)
+            {
+                throw std::invalid_argument(
+                    "The state has invalid bitboards.");
+            }
+        }
+    }
+}
+
+void Map::ReadState(const std::uint8_t*& in, const std::uint8_t* end)
+{
+    State& s = m_state;
+
+    std::uint64_t width = 0, height = 0;
+    ReadBytes(in, end, width);
+    ReadBytes(in, end, height);
+
+    ReadBytes(in, end, s.types);
+    ReadBytes(in, end, s.directions);
+    ReadBytes(in, end, s.moveFlags);
+    ReadBytes(in, end, s.changeFlags);
+    ReadBytes(in, end, s.removeFlags);
+    ReadBytes(in, end, s.cells);
+    ReadBytes(in, end, s.freeSlots);
+    ReadBytes(in, end, s.cellRanges);
+    ReadBytes(in, end, s.cellObjects);
+    ReadBytes(in, end, s.numUnusedObjects);
+    ReadBytes(in, end, s.ruleFlags);
+    ReadBytes(in, end, s.hasDirtyLines);
+    if (s.hasDirtyLines)
+    {
+        ReadBytes(in, end, s.dirtyRows);
+        ReadBytes(in, end, s.dirtyColumns);
+    }
+    else
+    {
+        ClearDirtyLines();
+    }
+    ReadBytes(in, end, s.hash);
+    ReadBytes(in, end, s.bitboards);
+
+    MarkAllCellsDirty();
+}
+
+Bitboard Map::GetBitboard(ObjectType type) const
+{
+    return Bitboard(
+        m_width * m_height,
+        m_state.bitboards.data() + ToBitboardIndex(type) * m_numWords);
+}
+
+void Map::MergeBitboard(ObjectType type, Bitboard& board) const
+{
+    board.OrWords(m_state.bitboards.data() +
+                  ToBitboardIndex(type) * m_numWords);
+}
+
+std::size_t Map::ToCell(std::size_t x, std::size_t y) const
+{
+    if (x >= m_width || y >= m_height)
+    {
+        throw std::out_of_range("The position is out of the map.");
+    }
+
+    return y * m_width + x;
+}
+
+SlotRange Map::GetCellSlots(std::uint32_t cell) const
+{
+    const CellRange& range = m_state.cellRanges[cell];
+    const ObjectSlot* objects = m_state.cellObjects.data() + range.begin;
+
+    return SlotRange(objects, objects + range.size);
+}
+
+ObjectSlot Map::AllocateSlot(const Object& obj, std::uint32_t cell)
+{
+    State& s = m_state;
+
+    // The id of the given object is not kept. The object gets the id of its
+    // slot, and the last freed slot is reused first.
+    if (!s.freeSlots.empty())
+    {
+        const ObjectSlot slot = s.freeSlots.back();
+        s.freeSlots.pop_back();
+
+        s.types[slot] = obj.GetType();
+        s.directions[slot] = obj.GetDirection();
+        s.moveFlags[slot] = obj.GetMoveFlag();
+        s.changeFlags[slot] = obj.GetChangeFlag();
+        s.removeFlags[slot] = obj.GetRemoveFlag() ? 1 : 0;
+        s.cells[slot] = cell;
+
+        return slot;
+    }
+
+    s.types.emplace_back(obj.GetType());
+    s.directions.emplace_back(obj.GetDirection());
+    s.moveFlags.emplace_back(obj.GetMoveFlag());
+    s.changeFlags.emplace_back(obj.GetChangeFlag());
+    s.removeFlags.emplace_back(obj.GetRemoveFlag() ? 1 : 0);
+    s.cells.emplace_back(cell);
+
+    return static_cast<ObjectSlot>(s.cells.size() - 1);
+}
+
+void Map::FreeSlot(ObjectSlot slot)
+{
+    m_state.cells[slot] = INVALID_CELL;
+    m_state.freeSlots.emplace_back(slot);
+}
+
+void Map::LinkSlot(std::uint32_t cell, ObjectSlot slot)
+{
+    State& s = m_state;
+
+    if (s.cellRanges[cell].size == s.cellRanges[cell].capacity)
+    {
+        GrowCell(cell);
+    }
+
+    // New objects are put on top of the square.
+    CellRange& range = s.cellRanges[cell];
+    s.cellObjects[range.begin + range.size] = slot;
+    ++range.size;
+
+    s.bitboards[ToBitboardIndex(s.types[slot]) * m_numWords + (cell >> 6)] |=
+        std::uint64_t{ 1 } << (cell & 63);
+
+    s.hash += GetObjectKey(cell, s.types[slot], s.directions[slot]);
+    MarkDirtyCell(cell);
+
+    if (!IsIconType(s.types[slot]))
+    {
+        MarkDirtyLines(cell);
+    }
+}
+
+void Map::UnlinkSlot(std::uint32_t cell, ObjectSlot slot)
+{
+    State& s = m_state;
+
+    // The order of the other objects on the square is kept.
+    CellRange& range = s.cellRanges[cell];
+    const auto begin = s.cellObjects.begin() + range.begin;
+    const auto end = begin + range.size;
+    const auto pos = std::find(begin, end, slot);
+    std::copy(pos + 1, end, pos);
+    --range.size;
+
+    UpdateBitboard(cell, s.types[slot]);
+
+    s.hash -= GetObjectKey(cell, s.types[slot], s.directions[slot]);
+    MarkDirtyCell(cell);
+
+    if (!IsIconType(s.types[slot]))
+    {
+        MarkDirtyLines(cell);
+    }
+}
+
+void Map::EndCell(std::uint32_t cell, std::uint32_t begin)
+{
+    State& s = m_state;
+
+    // The slots of the square were appended from begin, so the room is
+    // appended after them.
+    CellRange& range = s.cellRanges[cell];
+    range.begin = begin;
+    range.size = static_cast<std::uint32_t>(s.cellObjects.size()) - begin;
+    range.capacity = std::max(range.size, MIN_CELL_CAPACITY);
+    s.cellObjects.resize(range.begin + range.capacity, 0);
+}
+
+void Map::GrowCell(std::uint32_t cell)
+{
+    State& s = m_state;
+    CellRange& range = s.cellRanges[cell];
+
+    const std::uint32_t capacity =
+        std::max(range.capacity * 2, MIN_CELL_CAPACITY);
+    s.numUnusedObjects += range.capacity;
+    range.capacity = capacity;
+
+    if (s.numUnusedObjects > s.cellObjects.size() / 2)
+    {
+        CompactCells();
+        return;
+    }
+
+    const auto begin = static_cast<std::uint32_t>(s.cellObjects.size());
+    s.cellObjects.resize(begin + capacity, 0);
+    std::copy_n(s.cellObjects.begin() + range.begin, range.size,
+                s.cellObjects.begin() + begin);
+    range.begin = begin;
+}
+
+void Map::CompactCells()
+{
+    State& s = m_state;
+
+    // Squares are laid out again in order, each with its own room.
+    std::vector<ObjectSlot> cellObjects;
+    cellObjects.reserve(s.cellObjects.size() - s.numUnusedObjects);
+    for (CellRange& range : s.cellRanges)
+    {
+        const auto begin = static_cast<std::uint32_t>(cellObjects.size());
+        cellObjects.insert(cellObjects.end(),
+                           s.cellObjects.begin() + range.begin,
+                           s.cellObjects.begin() + range.begin + range.size);
+        cellObjects.resize(begin + range.capacity, 0);
+        range.begin = begin;
+    }
+
+    s.cellObjects = std::move(cellObjects);
+    s.numUnusedObjects = 0;
+}
+
+void Map::RemoveAllByType(std::uint32_t cell, ObjectType type)
+{
+    State& s = m_state;
+
+    std::uint32_t idx = 0;
+    while (idx < s.cellRanges[cell].size)
+    {
+        const ObjectSlot slot = s.cellObjects[s.cellRanges[cell].begin + idx];
+
+        if (s.types[slot] == type)
+        {
+            UnlinkSlot(cell, slot);
+            FreeSlot(slot);
+        }
+        else
+        {
+            ++idx;
+        }
+    }
+}
+
+void Map::FillEmptyCell(std::uint32_t cell)
+{
+    // An empty square always keeps an ICON_EMPTY object as a placeholder.
+    if (m_state.cellRanges[cell].size == 0)
+    {
+        LinkSlot(cell, AllocateSlot(Object(ObjectType::ICON_EMPTY), cell));
+    }
+}
+
+std::size_t Map::ToBitboardIndex(ObjectType type)
+{
+    if (IsIconType(type))
+    {
+        return static_cast<std::size_t>(type) -
+               static_cast<std::size_t>(ObjectType::ICON_TYPE) - 1;
+    }
+
+    // The last bitboard is shared by all text objects.
+    return NUM_BITBOARDS - 1;
+}
+
+void Map::UpdateBitboard(std::uint32_t cell, ObjectType type)
+{
+    const std::size_t boardIdx = ToBitboardIndex(type);
+    bool occupied = false;
+
+    for (const ObjectSlot slot : GetCellSlots(cell))
+    {
+        if (ToBitboardIndex(m_state.types[slot]) == boardIdx)
+        {
+            occupied = true;
+            break;
+        }
+    }
+
+    std::uint64_t& word =
+        m_state.bitboards[boardIdx * m_numWords + (cell >> 6)];
+    const std::uint64_t bit = std::uint64_t{ 1 } << (cell & 63);
+    word = occupied ? (word | bit) : (word & ~bit);
+}
+
+void Map::MarkDirtyLines(std::uint32_t cell)
+{
+    m_state.dirtyRows[cell / m_width] = 1;
+    m_state.dirtyColumns[cell % m_width] = 1;
+    m_state.hasDirtyLines = true;
+}
+
+void Map::MarkDirtyCell(std::uint32_t cell)
+{
+    if (m_allCellsDirty || m_dirtyCellFlags[cell] != 0)
+    {
+        return;
+    }
+
+    m_dirtyCellFlags[cell] = 1;
+    m_dirtyCells.emplace_back(cell);
+}
+
+void Map::FinishLoad()
+{
+    RebuildBitboards();
+    MarkAllLinesDirty();
+    m_state.hash = ComputeHash();
+    MarkAllCellsDirty();
+    SaveInitState();
+}
+
+void Map::RebuildBitboards()
+{
+    m_state.bitboards.assign(NUM_BITBOARDS * m_numWords, 0);
+
+    const std::size_t numCells = m_width * m_height;
+    for (std::size_t cell = 0; cell < numCells; ++cell)
+    {
+        for (const ObjectSlot slot :
+             GetCellSlots(static_cast<std::uint32_t>(cell)))
+        {
+            const ObjectType type = m_state.types[slot];
+            m_state.bitboards[ToBitboardIndex(type) * m_numWords +
+                              (cell >> 6)] |= std::uint64_t{ 1 }
+                                              << (cell & 63);
+        }
+    }
+}
 }  // namespace baba_is_auto
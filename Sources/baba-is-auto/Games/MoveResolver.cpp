@@ -0,0 +1,172 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <baba-is-auto/Games/MoveResolver.hpp>
+
+#include <utility>
+
+namespace baba_is_auto
+{
+namespace
+{
+bool IsHorizontal(Direction dir)
+{
+    return dir == Direction::LEFT || dir == Direction::RIGHT;
+}
+
+//! Shifts \p board so that each square gets the bit of the square \p n
+//! squares ahead of it in \p dir.
+void ShiftFromAhead(Bitboard& board, std::size_t n, std::size_t width,
+                    Direction dir)
+{
+    switch (dir)
+    {
+        case Direction::UP:
+            board.ShiftLeft(n * width);
+            break;
+        case Direction::DOWN:
+            board.ShiftRight(n * width);
+            break;
+        case Direction::LEFT:
+            board.ShiftLeft(n);
+            break;
+        case Direction::RIGHT:
+            board.ShiftRight(n);
+            break;
+        default:
+            break;
+    }
+}
+}  // namespace
+
+void MoveResolver::Invalidate()
+{
+    m_isValid.fill(false);
+    m_areBlockersValid = false;
+}
+
+void MoveResolver::NotifyMoved(const RuleManager& ruleManager,
+                               ObjectType type)
+{
+    // Moving an object may also take the placeholder off the square it
+    // enters, or leave one on the square it left.
+    for (const ObjectType blocker : { ObjectType::PUSH, ObjectType::STOP })
+    {
+        if (ruleManager.HasType(type, blocker) ||
+            ruleManager.HasType(ObjectType::ICON_EMPTY, blocker))
+        {
+            Invalidate();
+            return;
+        }
+    }
+}
+
+bool MoveResolver::CanMove(const Map& map, const RuleManager& ruleManager,
+                           std::size_t x, std::size_t y, Direction dir)
+{
+    if (dir == Direction::NONE)
+    {
+        return false;
+    }
+
+    return GetMovableBoard(map, ruleManager, dir)
+        .Test(y * map.GetWidth() + x);
+}
+
+const Bitboard& MoveResolver::GetMovableBoard(const Map& map,
+                                              const RuleManager& ruleManager,
+                                              Direction dir)
+{
+    const std::size_t idx = static_cast<std::size_t>(dir) - 1;
+    if (!m_isValid[idx])
+    {
+        Compute(map, ruleManager, dir);
+        m_isValid[idx] = true;
+    }
+
+    return m_movableBoards[idx];
+}
+
+void MoveResolver::Compute(const Map& map, const RuleManager& ruleManager,
+                           Direction dir)
+{
+    ComputeBlockers(map, ruleManager);
+    ++m_numComputations;
+
+    const bool isHorizontal = IsHorizontal(dir);
+    const Bitboard& edge =
+        dir == Direction::LEFT ? m_firstColumn : m_lastColumn;
+    Bitboard& open = m_movableBoards[static_cast<std::size_t>(dir) - 1];
+
+    // A square is open when an object can enter it from behind: it is free,
+    // or it has PUSH objects and the square ahead of it is open. A PUSH
+    // object on the edge can not be pushed off the map.
+    open = m_stopBoard;
+    open |= m_pushBoard;
+    open.Flip();
+
+    m_propagate = m_pushBoard;
+    m_propagate.AndNot(m_stopBoard);
+    if (isHorizontal)
+    {
+        m_propagate.AndNot(edge);
+    }
+
+    // After the step of n, a square is open if a free square follows a run
+    // of less than 2n PUSH squares ahead of it, and m_propagate has the
+    // squares that start a run of 2n PUSH squares. A run never crosses the
+    // edge, so shifting does not wrap around the rows.
+    const std::size_t width = m_width;
+    const std::size_t span = isHorizontal ? m_width : m_height;
+    for (std::size_t n = 1; n < span; n <<= 1)
+    {
+        m_shifted = open;
+        ShiftFromAhead(m_shifted, n, width, dir);
+        m_shifted &= m_propagate;
+        open |= m_shifted;
+
+        m_shifted = m_propagate;
+        ShiftFromAhead(m_shifted, n, width, dir);
+        m_propagate &= m_shifted;
+    }
+
+    // An object can move when the square ahead of it is open.
+    m_shifted = open;
+    ShiftFromAhead(m_shifted, 1, width, dir);
+    if (isHorizontal)
+    {
+        m_shifted.AndNot(edge);
+    }
+    std::swap(open, m_shifted);
+}
+
+void MoveResolver::ComputeBlockers(const Map& map,
+                                   const RuleManager& ruleManager)
+{
+    if (m_areBlockersValid)
+    {
+        return;
+    }
+
+    if (m_width != map.GetWidth() || m_height != map.GetHeight())
+    {
+        m_width = map.GetWidth();
+        m_height = map.GetHeight();
+        m_firstColumn = Bitboard(m_width * m_height);
+        m_lastColumn = Bitboard(m_width * m_height);
+
+        for (std::size_t y = 0; y < m_height; ++y)
+        {
+            m_firstColumn.Set(y * m_width);
+            m_lastColumn.Set(y * m_width + m_width - 1);
+        }
+    }
+
+    m_pushBoard = ruleManager.GetPropertyBitboard(map, ObjectType::PUSH);
+    m_stopBoard = ruleManager.GetPropertyBitboard(map, ObjectType::STOP);
+    m_areBlockersValid = true;
+}
+}  // namespace baba_is_auto
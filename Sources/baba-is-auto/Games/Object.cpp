@@ -11,19 +11,22 @@
 
 namespace baba_is_auto
 {
-ObjectId GlobalObjectId = 0; // a global variable to show the latest ID.
-
 /******************************************
                 Object
 *******************************************/
 Object::Object(ObjectType type, Direction dir){
-    // m_id = id;
     m_type = type;
     m_direction = dir;
     m_move_direction = Direction::NONE;
     m_is_removed = false;
     m_change_to = type;
-    SetNewObjectId();
+}
+
+Object::Object(ObjectType type, Direction dir, ObjectId id)
+    : m_id(id), m_type(type), m_direction(dir),
+      m_move_direction(Direction::NONE), m_is_removed(false), m_change_to(type)
+{
+    // Do nothing
 }
 
 bool Object::operator==(const Object& rhs) const
@@ -33,120 +36,28 @@ bool Object::operator==(const Object& rhs) const
 }
 
 
-ObjectId Object::SetNewObjectId(){
-    m_id = GlobalObjectId;
-    GlobalObjectId += 1;
-    return m_id;
-}
-
-
 
 /******************************************
                Square
 *******************************************/
 /*
-  This is a class to manage objects on a square of a map.
+  This is a class to copy objects on a square of a map.
 */
 
 Square::Square(std::size_t x, std::size_t y, ObjectContainer objects) 
     : m_x(x), m_y(y), m_objects(std::move(objects))
 {
-    m_objects.reserve(100);
-}
-
-// copy constructor
-Square::Square(const Square& sq){
-    m_x = sq.m_x;
-    m_y = sq.m_y;
-    m_objects = sq.m_objects;
-    m_objects.reserve(100); // allocate memories not to allow the vector to change addresses when a new element is appended.
-}
-
-
-void Square::AddObject(const Object& object){
-    std::cout << "<AddObject>" << std::endl;
-    std::cout << "(obj_id, x, y, obj_type) = "
-	      << object.GetId() << " "
-	      << m_x << " " << m_y << " " << static_cast<int>(object.GetType())
-	      << std::endl;
-    // <debug>: to check reallocation of std::vector.
-    // std::cout << "Capacity: " << m_objects.capacity() << std::endl;
-    // std::cout << "m_objects address: " 
-    // 	      << &m_objects[0]
-    // 	      << std::endl;
-    m_objects.emplace_back(object);
-    // std::cout << "m_objects address: " 
-    // 	      << &m_objects[0]
-    // 	      << std::endl;
-
-    RemoveAllByType(ObjectType::ICON_EMPTY);
+    // Do nothing
 }
 
-void Square::RemoveObject(const Object& object){
-    std::cout << "<RemoveObject>" << std::endl;
-    std::cout << "(obj_id, x, y, obj_type) = "
-	      << object.GetId() << " "
-	      << m_x << " " << m_y << " " 
-	      << static_cast<int>(object.GetType())  << " " 
-	      << std::endl;
-	      //<< static_cast<int>(object.GetDirection())
-
-    const auto itr = std::find(m_objects.begin(), m_objects.end(), object);
-
-    if (itr == m_objects.end()){
-	std::cout << "Exception: the object to be removed is not found in m_objects." << std::endl;
-	std::cout << "Candidate" << std::endl;
-
-	for (auto& obj: m_objects){
-	    std::cout << "(obj_id, obj_type, obj_dir) = "
-		      << static_cast<int>(obj.GetId()) 
-		      << " "
-		      << static_cast<int>(obj.GetType()) 
-		      << " "
-		      << static_cast<int>(obj.GetDirection())
-		      << std::endl;
-	}
-	std::cout << "Target Object" << std::endl;
-
-	std::cout << "(obj_id, obj_type, obj_dir) = "
-		  << static_cast<int>(object.GetId()) 
-		  << " "
-		  << static_cast<int>(object.GetType()) 
-		  << " "
-		  << static_cast<int>(object.GetDirection())
-		  << std::endl;
-
-	std::exit(EXIT_FAILURE);
-    }
-
-    m_objects.erase(itr);
-
-    if (m_objects.empty()){
-	Object empty = Object(ObjectType::ICON_EMPTY);
-	m_objects.emplace_back(empty);
-    }
-}
-
-void Square::RemoveAllByType(ObjectType type){
-    // std::erase_if(m_objects.begin(), m_objects.end(),
-    // 		  [&](Object x){
-    // 		      return x.GetType() == type; 
-    // 		  });
-    auto itr = std::remove_if(m_objects.begin(), m_objects.end(), 
-    			      [&](Object x){
-    				  return x.GetType() == type; 
-    			      }); 
-    // As the removed elements still exist at the end of the container, [itr, m_object.end()) needs to be cut off.
-    m_objects.erase(itr, m_objects.end()); 
-}
-
-
-const ObjectContainer& Square::GetObjects() const{
+const ObjectContainer& Square::GetObjects() const&{
     return m_objects;
 }
 
-ObjectContainer& Square::GetObjects(){
-    return m_objects;
+// Squares are usually temporary copies made by Map::At, so objects are moved
+// out of them instead of returning a dangling reference.
+ObjectContainer Square::GetObjects() &&{
+    return std::move(m_objects);
 }
 
 
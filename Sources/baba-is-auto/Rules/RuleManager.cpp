@@ -5,25 +5,48 @@
 // property of any third parties.
 
 #include <baba-is-auto/Rules/RuleManager.hpp>
+#include <baba-is-auto/Utils/Trace.hpp>
 
 #include <algorithm>
+#include <sstream>
+#include <stdexcept>
 #include <tuple>
 
 namespace baba_is_auto
 {
 
+std::string ToString(const TypeSequence& types)
+{
+    std::ostringstream stream;
+    for (auto& t: types){
+	stream << static_cast<int>(t) << " ";
+    }
+    return stream.str();
+}
+
 void DbgPrint(std::string title, TypeSequence types)
 {
-    std::cout << title << std::endl;
-    for (ObjectType& t: types)
-	{
-	    std::cout << static_cast<int>(t) << " ";
-	}
-    std::cout << std::endl;
+    BABA_TRACE(TraceLevel::VERBOSE, TraceCategory::RULE,
+	       title, "\n", ToString(types));
 }
 
 RuleManager::RuleManager()
 {
+    RebuildPropertyTable();
+}
+
+const std::vector<Grammar>& RuleManager::GetGrammars()
+{
+    // The grammars never change, so they are built once and shared by all
+    // rule managers. Copying a rule manager does not copy them.
+    static const std::vector<Grammar> grammars = BuildGrammars();
+    return grammars;
+}
+
+std::vector<Grammar> RuleManager::BuildGrammars()
+{
+    std::vector<Grammar> grammars;
+
     /*
        <Grammars>
        NOT = NOT NOT
@@ -64,158 +87,158 @@ RuleManager::RuleManager()
     {
 	TypeSequence src{ObjectType::NOT, ObjectType::NOT};
 	ObjectType tgt = ObjectType::NOT;
-	m_grammars.emplace_back(std::make_tuple(src, tgt));
+	grammars.emplace_back(std::make_tuple(src, tgt));
     }
 
     // NP = Noun
     for (auto& x: GetAllNouns()){
 	TypeSequence src{x};
 	ObjectType tgt = ObjectType::NP;
-	m_grammars.emplace_back(std::make_tuple(src, tgt));
+	grammars.emplace_back(std::make_tuple(src, tgt));
     }
     // Comp = Property
     for (auto& x: GetAllProperties()){
 	TypeSequence src{x};
 	ObjectType tgt = ObjectType::Complement;
-	m_grammars.emplace_back(std::make_tuple(src, tgt));
+	grammars.emplace_back(std::make_tuple(src, tgt));
     }
 
     // NP = NOT NP
     {
 	TypeSequence src{ObjectType::NOT, ObjectType::NP};
 	ObjectType tgt = ObjectType::NP;
-	m_grammars.emplace_back(std::make_tuple(src, tgt));
+	grammars.emplace_back(std::make_tuple(src, tgt));
     }
 
     // NP = NP AND NP
     {
 	TypeSequence src{ObjectType::NP, ObjectType::AND, ObjectType::NP};
 	ObjectType tgt = ObjectType::NP;
-	m_grammars.emplace_back(std::make_tuple(src, tgt));
+	grammars.emplace_back(std::make_tuple(src, tgt));
     }
 
     // Comp = NOT Comp
     {
 	TypeSequence src{ObjectType::NOT, ObjectType::Complement};
 	ObjectType tgt = ObjectType::Complement;
-	m_grammars.emplace_back(std::make_tuple(src, tgt));
+	grammars.emplace_back(std::make_tuple(src, tgt));
     }
     // Comp = NP AND Comp
     {
 	TypeSequence src{ObjectType::NP, ObjectType::AND, ObjectType::Complement};
 	ObjectType tgt = ObjectType::Complement;
-	m_grammars.emplace_back(std::make_tuple(src, tgt));
+	grammars.emplace_back(std::make_tuple(src, tgt));
     }
     // Comp = Comp AND NP
     {
 	TypeSequence src{ObjectType::Complement, ObjectType::AND, ObjectType::NP};
 	ObjectType tgt = ObjectType::Complement;
-	m_grammars.emplace_back(std::make_tuple(src, tgt));
+	grammars.emplace_back(std::make_tuple(src, tgt));
     }
     // Comp = Comp AND Comp
     {
 	TypeSequence src{ObjectType::Complement, ObjectType::AND, ObjectType::Complement};
 	ObjectType tgt = ObjectType::Complement;
-	m_grammars.emplace_back(std::make_tuple(src, tgt));
+	grammars.emplace_back(std::make_tuple(src, tgt));
     }
 
     // PreM = Pre-Modifier
     for (auto& x: GetAllPreModifiers()){
 	TypeSequence src{x};
 	ObjectType tgt = ObjectType::PreM;
-	m_grammars.emplace_back(std::make_tuple(src, tgt));
+	grammars.emplace_back(std::make_tuple(src, tgt));
     }
 
     // PreM = NOT PreM
     {
 	TypeSequence src{ObjectType::NOT, ObjectType::PreM};
 	ObjectType tgt = ObjectType::PreM;
-	m_grammars.emplace_back(std::make_tuple(src, tgt));
+	grammars.emplace_back(std::make_tuple(src, tgt));
     }
 
     // PreMP = PreM NP
     {
 	TypeSequence src{ObjectType::PreM, ObjectType::NP};
 	ObjectType tgt = ObjectType::PreMP;
-	m_grammars.emplace_back(std::make_tuple(src, tgt));
+	grammars.emplace_back(std::make_tuple(src, tgt));
     }
 
     // PostM = Post-Modifier
     for (auto& x: GetAllPostModifiers()){
 	TypeSequence src{x};
 	ObjectType tgt = ObjectType::PostM;
-	m_grammars.emplace_back(std::make_tuple(src, tgt));
+	grammars.emplace_back(std::make_tuple(src, tgt));
     }
 
     // PostM = NOT PostM
     {
 	TypeSequence src{ObjectType::NOT, ObjectType::PostM};
 	ObjectType tgt = ObjectType::PostM;
-	m_grammars.emplace_back(std::make_tuple(src, tgt));
+	grammars.emplace_back(std::make_tuple(src, tgt));
     }
 
     // PostMP = PostM NP
     {
 	TypeSequence src{ObjectType::PostM, ObjectType::NP};
 	ObjectType tgt = ObjectType::PostMP;
-	m_grammars.emplace_back(std::make_tuple(src, tgt));
+	grammars.emplace_back(std::make_tuple(src, tgt));
     }
 
     // VP = gen-Verb NP
     for (auto& x: GetAllGenVerbs()){
 	TypeSequence src{x, ObjectType::NP};
 	ObjectType tgt = ObjectType::VP;
-	m_grammars.emplace_back(std::make_tuple(src, tgt));
+	grammars.emplace_back(std::make_tuple(src, tgt));
     }
 
     // VP = IS Comp
     {
 	TypeSequence src{ObjectType::IS, ObjectType::Complement};
 	ObjectType tgt = ObjectType::VP;
-	m_grammars.emplace_back(std::make_tuple(src, tgt));
+	grammars.emplace_back(std::make_tuple(src, tgt));
     }
     // VP = IS NP
     {
 	TypeSequence src{ObjectType::IS, ObjectType::NP};
 	ObjectType tgt = ObjectType::VP;
-	m_grammars.emplace_back(std::make_tuple(src, tgt));
+	grammars.emplace_back(std::make_tuple(src, tgt));
     }
 
     // Subj = PreMP PostMP
     {
 	TypeSequence src{ObjectType::PreMP, ObjectType::PostMP};
 	ObjectType tgt = ObjectType::Subj;
-	m_grammars.emplace_back(std::make_tuple(src, tgt));
+	grammars.emplace_back(std::make_tuple(src, tgt));
     }
     // Subj = NP PostMP
     {
 	TypeSequence src{ObjectType::NP, ObjectType::PostMP};
 	ObjectType tgt = ObjectType::Subj;
-	m_grammars.emplace_back(std::make_tuple(src, tgt));
+	grammars.emplace_back(std::make_tuple(src, tgt));
     }
     // Subj = PreMP
     {
 	TypeSequence src{ObjectType::PreMP};
 	ObjectType tgt = ObjectType::Subj;
-	m_grammars.emplace_back(std::make_tuple(src, tgt));
+	grammars.emplace_back(std::make_tuple(src, tgt));
     }
     // Subj = NP
     {
 	TypeSequence src{ObjectType::NP};
 	ObjectType tgt = ObjectType::Subj;
-	m_grammars.emplace_back(std::make_tuple(src, tgt));
+	grammars.emplace_back(std::make_tuple(src, tgt));
     }
 
     // Rule = Subj VP
     {
 	TypeSequence src{ObjectType::Subj, ObjectType::VP};
 	ObjectType tgt = ObjectType::Rule;
-	m_grammars.emplace_back(std::make_tuple(src, tgt));
+	grammars.emplace_back(std::make_tuple(src, tgt));
     }
 
     // <debug>
     // std::cout << "Grammars" << std::endl;
-    // for (auto& g: m_grammars){
+    // for (auto& g: grammars){
     // 	TypeSequence v = std::get<0>(g);
     // 	ObjectType tgt = std::get<1>(g);
     // 	std::cout << "[ ";
@@ -226,23 +249,22 @@ RuleManager::RuleManager()
     // 	std::cout << std::endl;
     // }
 
+    return grammars;
 }
 
-void PrintNodeList(int i, std::vector<RuleNode>& nodes){
-    std::cout << "PrintNodeList: " << i <<  std::endl;
+void PrintNodeList(std::size_t i, const std::vector<RuleNode>& nodes){
+    TypeSequence tops;
     for (auto& node: nodes){
-	std::cout << static_cast<int>(node.m_top) << " ";
+	tops.emplace_back(node.m_top);
     }
-    std::cout << std::endl;
+    BABA_TRACE(TraceLevel::VERBOSE, TraceCategory::RULE,
+	       "PrintNodeList: ", i, "\n", ToString(tops));
 }
 
-void PrintGrammar(TypeSequence src, ObjectType tgt)
+void PrintGrammar(const TypeSequence& src, ObjectType tgt)
 {
-    for (auto& s: src){
-	std::cout << static_cast<int>(s) << " ";
-    }
-    std::cout << " -> ";
-    std::cout << static_cast<int>(tgt) << std::endl;
+    BABA_TRACE(TraceLevel::VERBOSE, TraceCategory::RULE,
+	       ToString(src), " -> ", static_cast<int>(tgt));
 }
 
 std::vector<RuleNode> UpdateNodes(std::vector<RuleNode> nodes, 
@@ -285,8 +307,8 @@ void RuleManager::BuildRuleTree(TypeSequence seq){
     }
 
     // Apply a grammar from left to right and update the node list.
-    std::cout << "<Node parsing>" << std::endl;
-    for (auto& g: m_grammars){
+    BABA_TRACE(TraceLevel::VERBOSE, TraceCategory::RULE, "<Node parsing>");
+    for (auto& g: GetGrammars()){
     	TypeSequence src = std::get<0>(g);
     	ObjectType tgt = std::get<1>(g);
 	std::size_t i = 0;
@@ -299,10 +321,11 @@ void RuleManager::BuildRuleTree(TypeSequence seq){
 	    // vector::operator== は内部比較で定義済みのRuleNode::operator==を使ってくれない？
 	    //if (sliced == src){
 	    if (std::equal(sliced.cbegin(), sliced.cend(), src.cbegin())){
-		std::cout << "=============" << std::endl;
-		std::cout << "<Grammar>" << std::endl;
+		BABA_TRACE(TraceLevel::VERBOSE, TraceCategory::RULE,
+			   "=============\n<Grammar>");
 		PrintGrammar(src, tgt);
-		std::cout << "<Current Nodes>" << std::endl;
+		BABA_TRACE(TraceLevel::VERBOSE, TraceCategory::RULE,
+			   "<Current Nodes>");
 		PrintNodeList(i, nodes);
 		if (src.size() == 1){
 		    left_idx = 0;
@@ -323,7 +346,8 @@ void RuleManager::BuildRuleTree(TypeSequence seq){
 		    RuleNode new_node = RuleNode(tgt, sliced.at(left_idx), sliced.at(right_idx));
 		    nodes = UpdateNodes(nodes, new_node, i, i+src.size());
 		}
-		std::cout << "<Next Nodes>" << std::endl; 
+		BABA_TRACE(TraceLevel::VERBOSE, TraceCategory::RULE,
+			   "<Next Nodes>");
 		PrintNodeList(i, nodes);
 	    } else {
 		i++;
@@ -352,6 +376,7 @@ void RuleManager::BuildRuleTree(TypeSequence seq){
 void RuleManager::AddRule(const Rule& rule)
 {
     m_rules.emplace_back(rule);
+    AddToPropertyTable(rule);
 }
 
 void RuleManager::RemoveRule(const Rule& rule)
@@ -363,12 +388,14 @@ void RuleManager::RemoveRule(const Rule& rule)
     const auto itr = std::find(m_rules.begin(), m_rules.end(), rule);
     if (itr != m_rules.end()){
         m_rules.erase(itr);
+        RebuildPropertyTable();
     }
 }
 
 void RuleManager::ClearRules()
 {
     m_rules.clear();
+    RebuildPropertyTable();
 }
 
 std::vector<Rule> RuleManager::GetAllRules() const
@@ -400,62 +427,325 @@ std::size_t RuleManager::GetNumRules() const
 
 
 bool RuleManager::HasType(const Object& obj, const Map& map, ObjectType tgtType) const {
-    auto objType = obj.GetType();
-    objType = IsIconType(objType) ? ConvertIconToText(objType) : ObjectType::TEXT;
+    return HasType(obj.GetType(), tgtType);
+}
 
-    // The three rules always implicitly exist unless denied.
-    // (TEXT IS PUSH, LEVEL IS STOP, CURSOR IS SELECT)
-    if ((objType == ObjectType::TEXT) && (tgtType == ObjectType::PUSH)){
-	return true;
+void RuleManager::AddToPropertyTable(const Rule& rule) {
+    const ObjectType subject = rule.GetSubject();
+    const ObjectType predicate = rule.GetPredicate();
+    if ((rule.GetOperator() != ObjectType::IS) || !IsNounType(subject) ||
+	!IsPropertyType(predicate)){
+	return;
     }
 
-    for (auto& rule : m_rules){
-	if (IsPropertyType(tgtType)){
-	    if ((rule.GetSubject() == objType) &&
-		(rule.GetOperator() == ObjectType::IS) &&
-		(rule.GetPredicate() == tgtType)){
-		return true;
+    const PropertyMask bit = ToPropertyBit(predicate);
+
+    // A noun covers its icons, and TEXT covers every object that is not an icon.
+    const ObjectType icon = ConvertTextToIcon(subject);
+    if (IsIconType(icon)){
+	m_propertyTable[static_cast<std::size_t>(icon)] |= bit;
+    }
+    if (subject == ObjectType::TEXT){
+	for (std::size_t type = 0; type < m_propertyTable.size(); ++type){
+	    if (!IsIconType(static_cast<ObjectType>(type))){
+		m_propertyTable[type] |= bit;
 	    }
 	}
-	// rule.HasTargetType(tgtType);
-	// rule.SatisfyCondition(obj, map);
+    }
+}
+
+void RuleManager::RebuildPropertyTable() {
+    m_propertyTable.fill(0);
+
+    // The three rules always implicitly exist unless denied.
+    // (TEXT IS PUSH, LEVEL IS STOP, CURSOR IS SELECT)
+    AddToPropertyTable(Rule(ObjectType::TEXT, ObjectType::IS, ObjectType::PUSH));
+
+    for (auto& rule : m_rules){
+	AddToPropertyTable(rule);
+    }
+}
+
+Bitboard RuleManager::GetPropertyBitboard(const Map& map, ObjectType property) const {
+    Bitboard board(map.GetWidth() * map.GetHeight());
+    if (!IsPropertyType(property)){
+	return board;
+    }
 
-	// else if (IsVerbType(tgtType)) {
-	//     if ((rule.GetSubject() == objType) &&
-	// 	(rule.GetOperator() == tgtType)){
-	// 	return true;
-	//     }
-	// }
+    const PropertyMask bit = ToPropertyBit(property);
+    for (auto type = static_cast<std::size_t>(ObjectType::ICON_TYPE) + 1;
+	 type < static_cast<std::size_t>(ObjectType::GRAMMAR_TYPE); ++type){
+	if (m_propertyTable[type] & bit){
+	    map.MergeBitboard(static_cast<ObjectType>(type), board);
+	}
     }
-    return false;
+    if (GetProperties(ObjectType::TEXT) & bit){
+	map.MergeBitboard(ObjectType::TEXT, board);
+    }
+    return board;
+}
+
+namespace
+{
+//! A rule as it is written in a snapshot. The line and the position are only
+//! used for the rules of lines.
+struct RuleRecord
+{
+    ObjectType subject;
+    ObjectType op;
+    ObjectType predicate;
+    // The padding is a member so that it is copied and equal states give
+    // equal snapshots.
+    std::uint8_t padding;
+    RuleDirection direction;
+    std::uint32_t line;
+    std::uint32_t pos;
+};
+
+RuleRecord ToRecord(const Rule& rule, RuleDirection direction = RuleDirection::HORIZONTAL,
+		    std::size_t line = 0, std::size_t pos = 0)
+{
+    return RuleRecord{ rule.GetSubject(), rule.GetOperator(), rule.GetPredicate(),
+		       0, direction, static_cast<std::uint32_t>(line),
+		       static_cast<std::uint32_t>(pos) };
 }
 
+ObjectType GetTextType(const Map& map, std::size_t x, std::size_t y)
+{
+    for (const ObjectSlot slot : map.GetSlots(x, y)){
+	const ObjectType type = map.GetType(slot);
+	if (!IsIconType(type)){
+	    return type;
+	}
+    }
+    return ObjectType::ICON_EMPTY;
+}
+}  // namespace
 
 void RuleManager::ParseRules(Map& map)
 {
-    ClearRules();
+    m_rowRules.clear();
+    m_columnRules.clear();
+    map.MarkAllLinesDirty();
+
+    UpdateRules(map);
+}
 
+void RuleManager::UpdateRules(Map& map)
+{
     const std::size_t width = map.GetWidth();
     const std::size_t height = map.GetHeight();
 
+    if (m_rowRules.size() != height || m_columnRules.size() != width)
+    {
+        m_rowRules.assign(height, LineRules());
+        m_columnRules.assign(width, LineRules());
+        map.MarkAllLinesDirty();
+    }
+
+    m_hasChangedProperties = false;
+
+    // Nothing to do if no text object has changed since the last call.
+    if (!map.HasDirtyLines())
+    {
+        return;
+    }
+
+    const PropertyTable prevTable = m_propertyTable;
+
     for (std::size_t y = 0; y < height; ++y)
     {
-        for (std::size_t x = 0; x < width; ++x)
+        if (map.IsDirtyRow(y))
         {
-            map.At(x, y).isRule = false;
+            ParseLine(map, y, RuleDirection::HORIZONTAL);
         }
     }
-
-    for (std::size_t y = 0; y < height; ++y)
+    for (std::size_t x = 0; x < width; ++x)
     {
-        for (std::size_t x = 0; x < width; ++x)
+        if (map.IsDirtyColumn(x))
         {
-            ParseRule(map, x, y, RuleDirection::HORIZONTAL);
-            ParseRule(map, x, y, RuleDirection::VERTICAL);
+            ParseLine(map, x, RuleDirection::VERTICAL);
         }
     }
+
+    map.ClearDirtyLines();
+    MergeLineRules();
+
+    m_hasChangedProperties = (m_propertyTable != prevTable);
+}
+
+void RuleManager::WriteState(ByteBuffer& out) const
+{
+    WriteBytes(out, static_cast<std::uint64_t>(m_rowRules.size()));
+    WriteBytes(out, static_cast<std::uint64_t>(m_columnRules.size()));
+
+    WriteBytes(out, static_cast<std::uint64_t>(m_rules.size()));
+    for (auto& rule : m_rules){
+	WriteBytes(out, ToRecord(rule));
+    }
+
+    // Only the lines that have rules are written.
+    std::uint64_t numLineRules = 0;
+    for (auto* lines : {&m_rowRules, &m_columnRules}){
+	for (auto& line : *lines){
+	    numLineRules += line.size();
+	}
+    }
+    WriteBytes(out, numLineRules);
+
+    for (std::size_t y = 0; y < m_rowRules.size(); ++y){
+	for (auto& [x, rule] : m_rowRules[y]){
+	    WriteBytes(out, ToRecord(rule, RuleDirection::HORIZONTAL, y, x));
+	}
+    }
+    for (std::size_t x = 0; x < m_columnRules.size(); ++x){
+	for (auto& [y, rule] : m_columnRules[x]){
+	    WriteBytes(out, ToRecord(rule, RuleDirection::VERTICAL, x, y));
+	}
+    }
+}
+
+void RuleManager::CheckState(const std::uint8_t*& in, const std::uint8_t* end,
+			     const Map& map) const
+{
+    std::uint64_t numRows = 0, numColumns = 0;
+    ReadBytes(in, end, numRows);
+    ReadBytes(in, end, numColumns);
+    if (numRows != map.GetHeight() || numColumns != map.GetWidth()){
+	throw std::invalid_argument("RuleManager - The rules are not of the map.");
+    }
+
+    // Only the lines of the rules are checked, since the rules are kept
+    // whatever their texts are.
+    ReadBytesView<RuleRecord>(in, end);
+
+    const auto lineRules = ReadBytesView<RuleRecord>(in, end);
+    for (std::size_t i = 0; i < lineRules.size(); ++i){
+	const RuleRecord record = lineRules[i];
+	const bool isHorizontal = (record.direction == RuleDirection::HORIZONTAL);
+	const std::size_t numLines = isHorizontal ? map.GetHeight() : map.GetWidth();
+	const std::size_t length = isHorizontal ? map.GetWidth() : map.GetHeight();
+
+	if ((!isHorizontal && record.direction != RuleDirection::VERTICAL) ||
+	    record.line >= numLines || record.pos >= length){
+	    throw std::invalid_argument("RuleManager - The rules have an invalid rule.");
+	}
+    }
+}
+
+void RuleManager::ReadState(const std::uint8_t*& in, const std::uint8_t* end)
+{
+    std::uint64_t numRows = 0, numColumns = 0;
+    ReadBytes(in, end, numRows);
+    ReadBytes(in, end, numColumns);
+
+    // Searches mostly restore states with the rules they already have, and
+    // the property table only depends on the rules.
+    const auto rules = ReadBytesView<RuleRecord>(in, end);
+    bool hasSameRules = (rules.size() == m_rules.size());
+    for (std::size_t i = 0; hasSameRules && i < rules.size(); ++i){
+	const RuleRecord record = rules[i];
+	const RuleRecord current = ToRecord(m_rules[i]);
+	hasSameRules = (record.subject == current.subject && record.op == current.op &&
+			record.predicate == current.predicate);
+    }
+    if (!hasSameRules){
+	m_rules.clear();
+	for (std::size_t i = 0; i < rules.size(); ++i){
+	    const RuleRecord record = rules[i];
+	    m_rules.emplace_back(record.subject, record.op, record.predicate);
+	}
+	RebuildPropertyTable();
+    }
+
+    m_rowRules.resize(static_cast<std::size_t>(numRows));
+    m_columnRules.resize(static_cast<std::size_t>(numColumns));
+    for (auto* lines : {&m_rowRules, &m_columnRules}){
+	for (auto& line : *lines){
+	    line.clear();
+	}
+    }
+
+    const auto lineRules = ReadBytesView<RuleRecord>(in, end);
+    for (std::size_t i = 0; i < lineRules.size(); ++i){
+	const RuleRecord record = lineRules[i];
+	auto& lines = (record.direction == RuleDirection::HORIZONTAL) ? m_rowRules : m_columnRules;
+	lines[record.line].emplace_back(record.pos, Rule(record.subject, record.op, record.predicate));
+    }
+
+    m_hasChangedProperties = true;
+}
+
+void RuleManager::ParseLine(Map& map, std::size_t idx, RuleDirection direction)
+{
+    // A rule read in a direction only depends on the texts of its line, so the
+    // rules of a line are found as ParseRule does for each square of the line.
+    const bool isHorizontal = (direction == RuleDirection::HORIZONTAL);
+    const std::size_t length = isHorizontal ? map.GetWidth() : map.GetHeight();
+    const auto GetX = [&](std::size_t pos) { return isHorizontal ? pos : idx; };
+    const auto GetY = [&](std::size_t pos) { return isHorizontal ? idx : pos; };
+
+    TypeSequence texts(length);
+    for (std::size_t pos = 0; pos < length; ++pos){
+	texts[pos] = GetTextType(map, GetX(pos), GetY(pos));
+	map.SetRule(GetX(pos), GetY(pos), direction, false);
+    }
+
+    LineRules& rules = isHorizontal ? m_rowRules[idx] : m_columnRules[idx];
+    rules.clear();
+
+    // The end of the sequence of text blocks from pos.
+    std::size_t end = 0;
+    for (std::size_t pos = 0; pos < length; ++pos){
+	if (end <= pos){
+	    end = pos;
+	    while (end < length && texts[end] != ObjectType::ICON_EMPTY){
+		++end;
+	    }
+	}
+	if (end - pos < 3) continue;
+
+	BABA_TRACE(TraceLevel::VERBOSE, TraceCategory::RULE,
+		   "(x, y, dir) = [", GetX(pos), ", ", GetY(pos), ", ",
+		   static_cast<int>(direction), "]");
+	if (Tracer::IsEnabled(TraceLevel::VERBOSE, TraceCategory::RULE)){
+	    BuildRuleTree(TypeSequence(texts.begin() + pos, texts.begin() + end));
+	}
+
+	// The rule is made of the first three texts, so cutting off the last
+	// texts of the sequence never makes an invalid rule valid.
+	Rule rule(texts[pos], texts[pos + 1], texts[pos + 2]);
+	if (!rule.IsValid()) continue;
+
+	for (std::size_t p = pos; p < end; ++p){
+	    map.SetRule(GetX(p), GetY(p), direction, true);
+	}
+	rules.emplace_back(pos, rule);
+    }
 }
 
+void RuleManager::MergeLineRules()
+{
+    // Keep the order of a full scan: by y, then by x, horizontal rules first.
+    std::vector<std::tuple<std::size_t, std::size_t, RuleDirection, const Rule*>> found;
+
+    for (std::size_t y = 0; y < m_rowRules.size(); ++y){
+	for (auto& [x, rule] : m_rowRules[y]){
+	    found.emplace_back(y, x, RuleDirection::HORIZONTAL, &rule);
+	}
+    }
+    for (std::size_t x = 0; x < m_columnRules.size(); ++x){
+	for (auto& [y, rule] : m_columnRules[x]){
+	    found.emplace_back(y, x, RuleDirection::VERTICAL, &rule);
+	}
+    }
+    std::sort(found.begin(), found.end());
+
+    ClearRules();
+    for (auto& entry : found){
+	AddRule(*std::get<3>(entry));
+    }
+}
 
 void RuleManager::ParseRule(Map& map, std::size_t x, std::size_t y, RuleDirection direction)
 {
@@ -465,12 +755,13 @@ void RuleManager::ParseRule(Map& map, std::size_t x, std::size_t y, RuleDirectio
     */
 
     // 1. Find the longest sequence of text blocks from (x, y).
+
     TypeSequence longest_seq;
     if (direction == RuleDirection::HORIZONTAL){
 	const std::size_t width = map.GetWidth();
     	for (std::size_t xx=x; xx<width; ++xx){
-	    if (map.At(xx, y).HasTextType()){
-    	        ObjectType type = map.At(xx, y).GetTextObjects()[0].GetType();
+	    const ObjectType type = GetTextType(map, xx, y);
+	    if (type != ObjectType::ICON_EMPTY){
     	    	longest_seq.emplace_back(type);
     	    } else {
     	    	break;
@@ -479,8 +770,8 @@ void RuleManager::ParseRule(Map& map, std::size_t x, std::size_t y, RuleDirectio
     } else if (direction == RuleDirection::VERTICAL){
     	const std::size_t height = map.GetHeight();
     	for (std::size_t yy=y; yy<height; ++yy){
-    	    if (map.At(x, yy).HasTextType()){
-    	        ObjectType type = map.At(x, yy).GetTextObjects()[0].GetType();
+	    const ObjectType type = GetTextType(map, x, yy);
+	    if (type != ObjectType::ICON_EMPTY){
     		longest_seq.emplace_back(type);
     	    } else {
     		break;
@@ -502,20 +793,27 @@ void RuleManager::ParseRule(Map& map, std::size_t x, std::size_t y, RuleDirectio
     while (true) {
     	if (seq.size() < 3) break;
     	//Rule rule = Rule(seq);
-	std::cout << "(x, y, dir) = [" << x << ", " << y << ", " << static_cast<int>(direction) << "]" << std::endl;
+	BABA_TRACE(TraceLevel::VERBOSE, TraceCategory::RULE,
+		   "(x, y, dir) = [", x, ", ", y, ", ",
+		   static_cast<int>(direction), "]");
     	Rule rule = Rule(seq[0], seq[1], seq[2]);
-	BuildRuleTree(seq); // debug for new parsing system
+
+	// The tree of the new parsing system is only used for debugging yet,
+	// so it is built only when somebody listens to it.
+	if (Tracer::IsEnabled(TraceLevel::VERBOSE, TraceCategory::RULE)){
+	    BuildRuleTree(seq);
+	}
 
     	if ((direction == RuleDirection::HORIZONTAL) && rule.IsValid()){
     	    for (std::size_t xx=x; xx<x+seq.size(); ++xx){
-    		map.At(xx, y).isRule = true;
+    		map.SetRule(xx, y, direction, true);
     	    }
     	    AddRule(rule);
     	    break;
     	}
     	if ((direction == RuleDirection::VERTICAL) && rule.IsValid()){
     	    for (std::size_t yy=y; yy<y+seq.size(); ++yy){
-    		map.At(x, yy).isRule = true;
+    		map.SetRule(x, yy, direction, true);
     	    }
     	    AddRule(rule);
     	    break;
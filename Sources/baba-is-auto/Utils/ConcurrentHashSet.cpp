@@ -0,0 +1,164 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <baba-is-auto/Utils/ConcurrentHashSet.hpp>
+
+#include <stdexcept>
+
+namespace baba_is_auto
+{
+namespace
+{
+std::size_t GetHomeSlot(std::uint64_t key, std::size_t numSlots)
+{
+    // Hashes of maps are sums of mixed keys, but mix once more so that the
+    // low bits used for the slot do not depend on few objects.
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdULL;
+    key ^= key >> 33;
+
+    return static_cast<std::size_t>(key) & (numSlots - 1);
+}
+}  // namespace
+
+ConcurrentHashSet::ConcurrentHashSet(std::size_t numKeys)
+{
+    Reserve(numKeys);
+}
+
+void ConcurrentHashSet::Reserve(std::size_t numKeys)
+{
+    std::size_t numSlots = 16;
+    while (numSlots < numKeys * MAX_LOAD_DIVISOR)
+    {
+        numSlots <<= 1;
+    }
+    if (numSlots <= m_numSlots)
+    {
+        return;
+    }
+
+    auto oldSlots = std::move(m_slots);
+    const std::size_t oldNumSlots = m_numSlots;
+
+    m_slots = std::make_unique<std::atomic<std::uint64_t>[]>(numSlots);
+    m_numSlots = numSlots;
+    for (std::size_t idx = 0; idx < numSlots; ++idx)
+    {
+        m_slots[idx].store(EMPTY, std::memory_order_relaxed);
+    }
+
+    for (std::size_t idx = 0; idx < oldNumSlots; ++idx)
+    {
+        const std::uint64_t key = oldSlots[idx].load(std::memory_order_relaxed);
+        if (key == EMPTY)
+        {
+            continue;
+        }
+
+        std::size_t slot = GetHomeSlot(key, m_numSlots);
+        while (m_slots[slot].load(std::memory_order_relaxed) != EMPTY)
+        {
+            slot = (slot + 1) & (m_numSlots - 1);
+        }
+        m_slots[slot].store(key, std::memory_order_relaxed);
+    }
+}
+
+void ConcurrentHashSet::Clear()
+{
+    for (std::size_t idx = 0; idx < m_numSlots; ++idx)
+    {
+        m_slots[idx].store(EMPTY, std::memory_order_relaxed);
+    }
+
+    m_size.store(0, std::memory_order_relaxed);
+    m_hasZero.store(false, std::memory_order_relaxed);
+}
+
+bool ConcurrentHashSet::Insert(std::uint64_t key)
+{
+    if (key == EMPTY)
+    {
+        if (m_hasZero.exchange(true, std::memory_order_relaxed))
+        {
+            return false;
+        }
+
+        m_size.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    std::size_t slot = GetHomeSlot(key, m_numSlots);
+    for (std::size_t probe = 0; probe < m_numSlots; ++probe)
+    {
+        std::uint64_t expected =
+            m_slots[slot].load(std::memory_order_relaxed);
+
+        if (expected == EMPTY &&
+            m_slots[slot].compare_exchange_strong(expected, key,
+                                                  std::memory_order_relaxed))
+        {
+            m_size.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        // Either the slot was taken before, or another thread has just
+        // claimed it. Both leave the key of the slot in expected.
+        if (expected == key)
+        {
+            return false;
+        }
+
+        slot = (slot + 1) & (m_numSlots - 1);
+    }
+
+    throw std::length_error("ConcurrentHashSet - The table is full.");
+}
+
+bool ConcurrentHashSet::Contains(std::uint64_t key) const
+{
+    if (key == EMPTY)
+    {
+        return m_hasZero.load(std::memory_order_relaxed);
+    }
+
+    std::size_t slot = GetHomeSlot(key, m_numSlots);
+    for (std::size_t probe = 0; probe < m_numSlots; ++probe)
+    {
+        const std::uint64_t stored =
+            m_slots[slot].load(std::memory_order_relaxed);
+
+        if (stored == key)
+        {
+            return true;
+        }
+        if (stored == EMPTY)
+        {
+            return false;
+        }
+
+        slot = (slot + 1) & (m_numSlots - 1);
+    }
+
+    return false;
+}
+
+std::size_t ConcurrentHashSet::Size() const
+{
+    return m_size.load(std::memory_order_relaxed);
+}
+
+std::size_t ConcurrentHashSet::GetCapacity() const
+{
+    return m_numSlots / MAX_LOAD_DIVISOR;
+}
+
+std::size_t ConcurrentHashSet::GetMemoryBytes() const
+{
+    return m_numSlots * sizeof(std::atomic<std::uint64_t>);
+}
+}  // namespace baba_is_auto
@@ -0,0 +1,161 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <baba-is-auto/Utils/MappedFile.hpp>
+
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace baba_is_auto
+{
+MappedFile::MappedFile(std::string_view filename)
+{
+    Open(filename);
+}
+
+MappedFile::~MappedFile()
+{
+    Close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : m_data(std::exchange(other.m_data, nullptr)),
+      m_size(std::exchange(other.m_size, 0))
+{
+    // Do nothing
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+{
+    if (this != &other)
+    {
+        Close();
+        m_data = std::exchange(other.m_data, nullptr);
+        m_size = std::exchange(other.m_size, 0);
+    }
+
+    return *this;
+}
+
+void MappedFile::Open(std::string_view filename)
+{
+    Close();
+
+    const std::string name(filename);
+    const std::string error = "MappedFile - Cannot map " + name + ".";
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(name.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                              nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL,
+                              nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        throw std::runtime_error(error);
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size))
+    {
+        CloseHandle(file);
+        throw std::runtime_error(error);
+    }
+
+    if (size.QuadPart == 0)
+    {
+        CloseHandle(file);
+        return;
+    }
+
+    // The view keeps the mapping alive, so both handles can be closed.
+    HANDLE mapping =
+        CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (mapping == nullptr)
+    {
+        throw std::runtime_error(error);
+    }
+
+    void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (data == nullptr)
+    {
+        throw std::runtime_error(error);
+    }
+
+    m_size = static_cast<std::size_t>(size.QuadPart);
+#else
+    const int fd = open(name.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        throw std::runtime_error(error);
+    }
+
+    struct stat status;
+    if (fstat(fd, &status) != 0)
+    {
+        close(fd);
+        throw std::runtime_error(error);
+    }
+
+    if (status.st_size == 0)
+    {
+        close(fd);
+        return;
+    }
+
+    // The mapping stays valid after the file is closed.
+    void* data = mmap(nullptr, static_cast<std::size_t>(status.st_size),
+                      PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+    {
+        throw std::runtime_error(error);
+    }
+
+    m_size = static_cast<std::size_t>(status.st_size);
+#endif
+
+    m_data = static_cast<const std::uint8_t*>(data);
+}
+
+void MappedFile::Close()
+{
+    if (m_data != nullptr)
+    {
+#ifdef _WIN32
+        UnmapViewOfFile(m_data);
+#else
+        munmap(const_cast<std::uint8_t*>(m_data), m_size);
+#endif
+    }
+
+    m_data = nullptr;
+    m_size = 0;
+}
+
+const std::uint8_t* MappedFile::GetData() const
+{
+    return m_data;
+}
+
+std::size_t MappedFile::GetSize() const
+{
+    return m_size;
+}
+}  // namespace baba_is_auto
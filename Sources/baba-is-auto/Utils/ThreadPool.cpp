@@ -0,0 +1,119 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <baba-is-auto/Utils/ThreadPool.hpp>
+
+namespace baba_is_auto
+{
+ThreadPool::ThreadPool(std::size_t numThreads)
+{
+    if (numThreads == 0)
+    {
+        numThreads = std::thread::hardware_concurrency();
+    }
+    if (numThreads == 0)
+    {
+        numThreads = 1;
+    }
+
+    m_workers.reserve(numThreads - 1);
+    for (std::size_t threadIdx = 1; threadIdx < numThreads; ++threadIdx)
+    {
+        m_workers.emplace_back(&ThreadPool::WorkerLoop, this, threadIdx);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isStopping = true;
+    }
+    m_jobReady.notify_all();
+
+    for (auto& worker : m_workers)
+    {
+        worker.join();
+    }
+}
+
+std::size_t ThreadPool::GetNumThreads() const
+{
+    return m_workers.size() + 1;
+}
+
+void ThreadPool::Run(const std::function<void(std::size_t)>& func)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_job = &func;
+        m_numRunning = m_workers.size();
+        m_exception = nullptr;
+        ++m_generation;
+    }
+    m_jobReady.notify_all();
+
+    Execute(0);
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_jobDone.wait(lock, [this] { return m_numRunning == 0; });
+    m_job = nullptr;
+
+    if (m_exception)
+    {
+        std::rethrow_exception(m_exception);
+    }
+}
+
+void ThreadPool::WorkerLoop(std::size_t threadIdx)
+{
+    std::size_t generation = 0;
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_jobReady.wait(lock, [&] {
+                return m_isStopping || m_generation != generation;
+            });
+
+            if (m_isStopping)
+            {
+                return;
+            }
+            generation = m_generation;
+        }
+
+        Execute(threadIdx);
+
+        bool isLast = false;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            isLast = --m_numRunning == 0;
+        }
+        if (isLast)
+        {
+            m_jobDone.notify_one();
+        }
+    }
+}
+
+void ThreadPool::Execute(std::size_t threadIdx)
+{
+    try
+    {
+        (*m_job)(threadIdx);
+    }
+    catch (...)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_exception)
+        {
+            m_exception = std::current_exception();
+        }
+    }
+}
+}  // namespace baba_is_auto
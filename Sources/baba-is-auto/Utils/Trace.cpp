@@ -0,0 +1,205 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <baba-is-auto/Utils/Trace.hpp>
+
+#include <iostream>
+
+namespace baba_is_auto
+{
+namespace
+{
+struct SinkHolder
+{
+    std::mutex mutex;
+    std::shared_ptr<ITraceSink> sink =
+        std::make_shared<StreamTraceSink>(std::clog);
+};
+
+SinkHolder& GetSinkHolder()
+{
+    static SinkHolder holder;
+    return holder;
+}
+
+void WriteFormatted(std::ostream& stream, const TraceRecord& record)
+{
+    stream << '[' << ToString(record.level) << "]["
+           << ToString(record.category) << "] " << record.message << '\n';
+}
+}  // namespace
+
+std::atomic<int> Tracer::m_level{ static_cast<int>(TraceLevel::VERBOSE) };
+std::atomic<unsigned int> Tracer::m_categories{ (1u << NUM_TRACE_CATEGORIES) -
+                                                1u };
+
+const char* ToString(TraceLevel level)
+{
+    switch (level)
+    {
+        case TraceLevel::VERBOSE:
+            return "VERBOSE";
+        case TraceLevel::INFO:
+            return "INFO";
+        case TraceLevel::WARNING:
+            return "WARNING";
+        case TraceLevel::FATAL:
+            return "FATAL";
+    }
+
+    return "UNKNOWN";
+}
+
+const char* ToString(TraceCategory category)
+{
+    switch (category)
+    {
+        case TraceCategory::MAP:
+            return "MAP";
+        case TraceCategory::RULE:
+            return "RULE";
+        case TraceCategory::GAME:
+            return "GAME";
+        case TraceCategory::AGENT:
+            return "AGENT";
+    }
+
+    return "UNKNOWN";
+}
+
+StreamTraceSink::StreamTraceSink(std::ostream& stream) : m_stream(stream)
+{
+    // Do nothing
+}
+
+void StreamTraceSink::Write(const TraceRecord& record)
+{
+    WriteFormatted(m_stream, record);
+}
+
+void StreamTraceSink::Flush()
+{
+    m_stream.flush();
+}
+
+FileTraceSink::FileTraceSink(std::string_view filename)
+    : m_file(std::string(filename))
+{
+    // Do nothing
+}
+
+void FileTraceSink::Write(const TraceRecord& record)
+{
+    WriteFormatted(m_file, record);
+}
+
+void FileTraceSink::Flush()
+{
+    m_file.flush();
+}
+
+RingBufferTraceSink::RingBufferTraceSink(std::size_t capacity)
+    : m_capacity(capacity)
+{
+    m_records.reserve(m_capacity);
+}
+
+void RingBufferTraceSink::Write(const TraceRecord& record)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_capacity == 0)
+    {
+        return;
+    }
+
+    if (m_records.size() < m_capacity)
+    {
+        m_records.emplace_back(record);
+    }
+    else
+    {
+        m_records[m_next] = record;
+    }
+
+    m_next = (m_next + 1) % m_capacity;
+}
+
+std::vector<TraceRecord> RingBufferTraceSink::GetRecords() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_records.size() < m_capacity)
+    {
+        return m_records;
+    }
+
+    // The oldest record is the one that will be overwritten next.
+    std::vector<TraceRecord> records;
+    records.reserve(m_records.size());
+    records.insert(records.end(), m_records.begin() + m_next, m_records.end());
+    records.insert(records.end(), m_records.begin(), m_records.begin() + m_next);
+
+    return records;
+}
+
+void RingBufferTraceSink::Clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_records.clear();
+    m_next = 0;
+}
+
+void Tracer::SetSink(std::shared_ptr<ITraceSink> sink)
+{
+    SinkHolder& holder = GetSinkHolder();
+    std::lock_guard<std::mutex> lock(holder.mutex);
+
+    holder.sink = std::move(sink);
+}
+
+void Tracer::SetLevel(TraceLevel level)
+{
+    m_level.store(static_cast<int>(level), std::memory_order_relaxed);
+}
+
+void Tracer::EnableCategory(TraceCategory category, bool enabled)
+{
+    const unsigned int bit = 1u << static_cast<int>(category);
+
+    if (enabled)
+    {
+        m_categories.fetch_or(bit, std::memory_order_relaxed);
+    }
+    else
+    {
+        m_categories.fetch_and(~bit, std::memory_order_relaxed);
+    }
+}
+
+void Tracer::Flush()
+{
+    SinkHolder& holder = GetSinkHolder();
+    std::lock_guard<std::mutex> lock(holder.mutex);
+
+    if (holder.sink)
+    {
+        holder.sink->Flush();
+    }
+}
+
+void Tracer::WriteRecord(const TraceRecord& record)
+{
+    SinkHolder& holder = GetSinkHolder();
+    std::lock_guard<std::mutex> lock(holder.mutex);
+
+    if (holder.sink)
+    {
+        holder.sink->Write(record);
+    }
+}
+}  // namespace baba_is_auto
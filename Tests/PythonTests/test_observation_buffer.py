@@ -0,0 +1,34 @@
+"""
+Copyright (c) 2020 Chris Ohk
+
+I am making my contributions/submissions to this project solely in our
+personal capacity and am not conveying any rights to any intellectual
+property of any third parties.
+"""
+
+import numpy as np
+import pyBaba
+
+
+def test_observation_buffer_view():
+    game = pyBaba.Game("Resources/Maps/baba_is_you.txt")
+    buffer = pyBaba.ObservationBuffer(game)
+    view = np.asarray(buffer)
+
+    assert view.dtype == np.float32
+    assert view.shape == (buffer.GetNumChannels(), buffer.GetHeight(),
+                          buffer.GetWidth())
+    assert view.flags["C_CONTIGUOUS"]
+    assert np.shares_memory(view, np.asarray(buffer))
+    assert np.array_equal(view, pyBaba.Preprocess.StateToArray(game))
+
+    # The view is not a copy, so it follows each Update.
+    before = view.copy()
+    game.MovePlayer(pyBaba.Direction.DOWN)
+    buffer.Update(game)
+    assert not np.array_equal(view, before)
+    assert np.array_equal(view, pyBaba.Preprocess.StateToArray(game))
+
+    game.MovePlayer(pyBaba.Direction.DOWN)
+    buffer.UpdateChanges(game)
+    assert np.array_equal(view, pyBaba.Preprocess.StateToArray(game))
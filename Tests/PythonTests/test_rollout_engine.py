@@ -0,0 +1,46 @@
+"""
+Copyright (c) 2020 Chris Ohk
+
+I am making my contributions/submissions to this project solely in our
+personal capacity and am not conveying any rights to any intellectual
+property of any third parties.
+"""
+
+import pyBaba
+import pytest
+
+
+def test_rollout_engine_basic():
+    game = pyBaba.Game("Resources/Maps/baba_is_you.txt")
+    options = pyBaba.RolloutOptions(numPlayouts=20, maxDepth=10,
+                                    numThreads=2, seed=1)
+    engine = pyBaba.RolloutEngine(options)
+    stats = engine.Run(game)
+    assert stats.numPlayouts == 20
+    assert stats.numWins + stats.numLosses + stats.numUnfinished == 20
+    assert stats.numThreads == 2
+
+
+def test_rollout_engine_agent_factory():
+    game = pyBaba.Game("Resources/Maps/baba_is_you.txt")
+    options = pyBaba.RolloutOptions(numPlayouts=20, maxDepth=10,
+                                    numThreads=2, seed=1)
+    agents = []
+
+    def make_agent():
+        agent = pyBaba.RandomAgent()
+        agents.append(agent)
+        return agent
+
+    engine = pyBaba.RolloutEngine(options, make_agent)
+    assert len(agents) == 2
+    stats = engine.Run(game)
+    assert stats.numPlayouts == 20
+    assert stats.numWins + stats.numLosses + stats.numUnfinished == 20
+
+
+def test_rollout_engine_bad_agent_factory():
+    options = pyBaba.RolloutOptions(numPlayouts=20, maxDepth=10,
+                                    numThreads=1, seed=1)
+    with pytest.raises(ValueError):
+        pyBaba.RolloutEngine(options, lambda: None)
@@ -0,0 +1,118 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest.h"
+
+#undef NEAR
+
+#include "TestUtils.hpp"
+
+#include <baba-is-auto/Agents/BFSSolverAgent.hpp>
+#include <baba-is-auto/Agents/ObservationEncoder.hpp>
+#include <baba-is-auto/Games/BatchGame.hpp>
+
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace baba_is_auto;
+
+TEST_CASE("BatchGame - Step")
+{
+    constexpr std::size_t NUM_GAMES = 6;
+    constexpr std::size_t MAX_EPISODE_STEPS = 10;
+    const StepRewards rewards;
+
+    BatchGame batch(MAPS_DIR "debug2.txt", NUM_GAMES, 2, rewards,
+                    MAX_EPISODE_STEPS);
+    const std::size_t observationSize = batch.GetObservationSize();
+
+    // The first game plays a solution over and over, the others play at
+    // random, and each step is checked against games played one by one.
+    std::vector<Game> games(NUM_GAMES, Game(MAPS_DIR "debug2.txt"));
+    std::vector<std::size_t> episodeSteps(NUM_GAMES, 0);
+
+    BFSSolverAgent solver;
+    REQUIRE(solver.Solve(games.front()) == SearchStatus::SOLVED);
+    const std::vector<Direction>& solution = solver.GetSolution();
+    const std::uint64_t initHash = games.front().Hash();
+
+    std::mt19937 rng(13);
+    std::size_t numWins = 0, numTimeouts = 0;
+
+    for (int step = 0; step < 200; ++step)
+    {
+        std::vector<Direction> actions(NUM_GAMES);
+        actions[0] = solution[episodeSteps[0] % solution.size()];
+        for (std::size_t idx = 1; idx < NUM_GAMES; ++idx)
+        {
+            actions[idx] = RandomDirection(rng);
+        }
+        batch.Step(actions);
+
+        for (std::size_t idx = 0; idx < NUM_GAMES; ++idx)
+        {
+            Game& game = games[idx];
+            game.MovePlayer(actions[idx]);
+            ++episodeSteps[idx];
+
+            const PlayState playState = game.GetPlayState();
+            const float reward = playState == PlayState::WON ? rewards.win
+                                 : playState == PlayState::LOST
+                                     ? rewards.lose
+                                     : rewards.step;
+            const bool isDone = playState != PlayState::PLAYING ||
+                                episodeSteps[idx] >= MAX_EPISODE_STEPS;
+
+            CHECK(batch.GetPlayStates()[idx] == playState);
+            CHECK_EQ(batch.GetRewards()[idx], reward);
+            CHECK_EQ(batch.GetDones()[idx], isDone ? 1 : 0);
+
+            if (isDone)
+            {
+                numWins += playState == PlayState::WON ? 1 : 0;
+                numTimeouts += playState == PlayState::PLAYING ? 1 : 0;
+
+                game.Reset();
+                episodeSteps[idx] = 0;
+            }
+
+            // A game that is done is reset, and its observation is the
+            // first one of the next episode.
+            CHECK_EQ(batch.GetGame(idx).Hash(), game.Hash());
+            CHECK_EQ(batch.GetEpisodeSteps()[idx], episodeSteps[idx]);
+
+            const std::vector<float> observation =
+                ObservationEncoder::GetDefault().Encode(game);
+            CHECK(std::equal(observation.begin(), observation.end(),
+                             batch.GetObservations().begin() +
+                                 idx * observationSize));
+        }
+    }
+
+    CHECK_GT(numWins, 0u);
+    CHECK_GT(numTimeouts, 0u);
+
+    batch.Reset();
+    for (std::size_t idx = 0; idx < NUM_GAMES; ++idx)
+    {
+        CHECK_EQ(batch.GetGame(idx).Hash(), initHash);
+        CHECK_EQ(batch.GetEpisodeSteps()[idx], 0u);
+        CHECK_EQ(batch.GetDones()[idx], 0);
+    }
+}
+
+TEST_CASE("BatchGame - Bad actions")
+{
+    BatchGame batch(MAPS_DIR "debug2.txt", 2);
+
+    CHECK_THROWS_AS(batch.Step(std::vector<Direction>{ Direction::UP }),
+                    std::invalid_argument);
+    CHECK_THROWS_AS(batch.Step(std::vector<Direction>{
+                        Direction::UP, static_cast<Direction>(5) }),
+                    std::invalid_argument);
+}
@@ -0,0 +1,97 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest.h"
+
+#undef NEAR
+
+#include "TestUtils.hpp"
+
+#include <baba-is-auto/Games/Game.hpp>
+#include <baba-is-auto/Games/GameProfile.hpp>
+
+#include <random>
+
+using namespace baba_is_auto;
+
+TEST_CASE("GameProfile - Steps")
+{
+    Game game(MAPS_DIR "baba_is_you.txt");
+    game.SetProfiling(true);
+    std::mt19937 rng(37);
+
+    // Each step runs each phase once.
+    PlayRandomly(game, rng, 50, [](int) {});
+
+    const GameProfile& profile = game.GetProfile();
+    CHECK(profile.IsEnabled());
+    for (std::size_t phase = 0; phase < GameProfile::NUM_PHASES; ++phase)
+    {
+        CHECK_EQ(profile.GetNumCalls(static_cast<GamePhase>(phase)), 50u);
+    }
+    CHECK_GT(profile.GetTotalNanoseconds(GamePhase::STEP), 0u);
+    CHECK_GT(profile.GetCount(GameCounter::HAS_TYPE), 0u);
+    CHECK_GT(profile.GetCount(GameCounter::OBJECTS_SCANNED), 0u);
+
+    // The statistics are kept when profiling is turned off, until they are
+    // reset.
+    game.SetProfiling(false);
+    PlayRandomly(game, rng, 10, [](int) {});
+    CHECK_EQ(profile.GetNumCalls(GamePhase::STEP), 50u);
+
+    game.ResetProfile();
+    for (std::size_t phase = 0; phase < GameProfile::NUM_PHASES; ++phase)
+    {
+        CHECK_EQ(profile.GetNumCalls(static_cast<GamePhase>(phase)), 0u);
+        CHECK_EQ(profile.GetTotalNanoseconds(static_cast<GamePhase>(phase)),
+                 0u);
+    }
+    for (std::size_t counter = 0; counter < GameProfile::NUM_COUNTERS;
+         ++counter)
+    {
+        CHECK_EQ(profile.GetCount(static_cast<GameCounter>(counter)), 0u);
+    }
+}
+
+TEST_CASE("GameProfile - Disabled")
+{
+    Game game(MAPS_DIR "baba_is_you.txt");
+    std::mt19937 rng(37);
+    PlayRandomly(game, rng, 20, [](int) {});
+
+    const GameProfile& profile = game.GetProfile();
+    CHECK_FALSE(game.IsProfiling());
+    CHECK_FALSE(profile.IsEnabled());
+    CHECK_EQ(profile.GetNumCalls(GamePhase::STEP), 0u);
+    CHECK_EQ(profile.GetCount(GameCounter::HAS_TYPE), 0u);
+    CHECK_EQ(profile.GetMeanNanoseconds(GamePhase::STEP), 0.0);
+    CHECK_EQ(profile.GetPercentileNanoseconds(GamePhase::STEP, 50.0), 0.0);
+}
+
+TEST_CASE("GameProfile - Percentiles")
+{
+    GameProfile profile;
+    profile.Enable();
+
+    for (std::uint64_t nanoseconds = 1; nanoseconds <= 1000; ++nanoseconds)
+    {
+        profile.AddPhaseTime(GamePhase::MOVE, nanoseconds * 100);
+    }
+
+    // The histogram knows a percentile within about 6%.
+    CHECK_EQ(profile.GetNumCalls(GamePhase::MOVE), 1000u);
+    CHECK_EQ(profile.GetTotalNanoseconds(GamePhase::MOVE), 50050000u);
+    CHECK_EQ(profile.GetMeanNanoseconds(GamePhase::MOVE), 50050.0);
+    CHECK_GE(profile.GetPercentileNanoseconds(GamePhase::MOVE, 50.0),
+             50000.0 * 0.94);
+    CHECK_LE(profile.GetPercentileNanoseconds(GamePhase::MOVE, 50.0),
+             50000.0 * 1.06);
+    CHECK_GE(profile.GetPercentileNanoseconds(GamePhase::MOVE, 99.0),
+             99000.0 * 0.94);
+    CHECK_LE(profile.GetPercentileNanoseconds(GamePhase::MOVE, 99.0),
+             99000.0 * 1.06);
+    CHECK_EQ(profile.GetNumCalls(GamePhase::STEP), 0u);
+}
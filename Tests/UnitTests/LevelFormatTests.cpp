@@ -0,0 +1,217 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest.h"
+
+#undef NEAR
+
+#include "TestUtils.hpp"
+
+#include <baba-is-auto/Games/Game.hpp>
+#include <baba-is-auto/Games/LevelCorpus.hpp>
+#include <baba-is-auto/Games/LevelFormat.hpp>
+
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace baba_is_auto;
+
+namespace
+{
+void WriteFile(const std::string& filename, const ByteBuffer& bytes)
+{
+    std::ofstream file(filename, std::ios::binary);
+    file.write(reinterpret_cast<const char*>(bytes.data()),
+               static_cast<std::streamsize>(bytes.size()));
+}
+
+bool RejectsLevel(Map& map, const ByteBuffer& level)
+{
+    try
+    {
+        map.LoadLevel(level.data(), level.size());
+    }
+    catch (const std::invalid_argument&)
+    {
+        return true;
+    }
+
+    return false;
+}
+
+bool RejectsCorpus(const ByteBuffer& corpus)
+{
+    const std::string filename = "LevelFormatTests-bad.babc";
+    WriteFile(filename, corpus);
+
+    bool isRejected = false;
+    try
+    {
+        LevelCorpus levelCorpus(filename);
+    }
+    catch (const std::invalid_argument&)
+    {
+        isRejected = true;
+    }
+
+    std::remove(filename.c_str());
+    return isRejected;
+}
+}  // namespace
+
+TEST_CASE("LevelFormat - EncodeLevel")
+{
+    for (const char* name : MAPS)
+    {
+        Game game(std::string(MAPS_DIR) + name);
+        std::mt19937 rng(3);
+
+        PlayRandomly(game, rng, 30, [](int) {});
+
+        // Stacked objects and their directions are kept.
+        const ByteBuffer level = EncodeLevel(game.GetMap());
+        Map map;
+        map.LoadLevel(level.data(), level.size());
+
+        CHECK(EncodeLevel(map) == level);
+        CHECK_EQ(map.GetHash(), game.GetMap().GetHash());
+        CHECK_EQ(map.GetNumObjects(), game.GetMap().GetNumObjects());
+    }
+}
+
+TEST_CASE("LevelFormat - Level and corpus files")
+{
+    std::vector<std::string> names;
+    std::vector<ByteBuffer> levels;
+    for (const char* name : MAPS)
+    {
+        const Game game(std::string(MAPS_DIR) + name);
+        names.emplace_back(name);
+        levels.emplace_back(EncodeLevel(game.GetMap()));
+    }
+
+    const std::string levelFilename = "LevelFormatTests.babl";
+    const std::string corpusFilename = "LevelFormatTests.babc";
+    WriteFile(levelFilename, levels[2]);
+    WriteFile(corpusFilename, EncodeCorpus(names, levels));
+
+    {
+        const LevelCorpus corpus(corpusFilename);
+        CHECK_EQ(corpus.GetNumLevels(), names.size());
+        CHECK_EQ(corpus.FindLevel("missing.txt"), corpus.GetNumLevels());
+
+        for (std::size_t idx = 0; idx < names.size(); ++idx)
+        {
+            CHECK_EQ(corpus.GetName(idx), names[idx]);
+            CHECK_EQ(corpus.FindLevel(names[idx]), idx);
+        }
+
+        // A game of a level file or a corpus plays as the text map does.
+        Game game1(std::string(MAPS_DIR) + MAPS[2]);
+        Game game2(levelFilename);
+        Game game3(corpus, corpus.FindLevel(MAPS[2]));
+        std::mt19937 rng(7);
+
+        for (int step = 0; step < 200; ++step)
+        {
+            CHECK_EQ(game2.Hash(), game1.Hash());
+            CHECK_EQ(game3.Hash(), game1.Hash());
+            CHECK(game2.GetRuleManager().GetAllRules() ==
+                  game1.GetRuleManager().GetAllRules());
+
+            const Direction dir = RandomDirection(rng);
+            game1.MovePlayer(dir);
+            game2.MovePlayer(dir);
+            game3.MovePlayer(dir);
+
+            if (game1.GetPlayState() != PlayState::PLAYING)
+            {
+                game1.Reset();
+                game2.Reset();
+                game3.Reset();
+            }
+        }
+    }
+
+    std::remove(levelFilename.c_str());
+    std::remove(corpusFilename.c_str());
+}
+
+TEST_CASE("LevelFormat - Bad levels")
+{
+    const Game game(MAPS_DIR "baba_is_you.txt");
+    const ByteBuffer level = EncodeLevel(game.GetMap());
+
+    Map map(2, 2);
+    const ByteBuffer initLevel = EncodeLevel(map);
+
+    bool rejectsTruncated = true;
+    for (std::size_t size = 0; size < level.size(); ++size)
+    {
+        rejectsTruncated &=
+            RejectsLevel(map, ByteBuffer(level.begin(), level.begin() + size));
+    }
+    CHECK(rejectsTruncated);
+
+    ByteBuffer badMagic = level;
+    badMagic[0] = 'X';
+    CHECK(RejectsLevel(map, badMagic));
+
+    ByteBuffer badVersion = level;
+    badVersion[offsetof(LevelHeader, version)] = 0xff;
+    CHECK(RejectsLevel(map, badVersion));
+
+    // The offsets of the squares must not go back.
+    ByteBuffer badOffsets = level;
+    const std::size_t offset = sizeof(LevelHeader) + 3 * sizeof(std::uint32_t);
+    const std::uint32_t badOffset = 0xffff;
+    std::memcpy(badOffsets.data() + offset, &badOffset, sizeof(badOffset));
+    CHECK(RejectsLevel(map, badOffsets));
+
+    const std::size_t objects =
+        level.size() - game.GetMap().GetNumObjects() * sizeof(LevelObject);
+
+    ByteBuffer badType = level;
+    badType[objects + offsetof(LevelObject, type)] = 0xff;
+    CHECK(RejectsLevel(map, badType));
+
+    ByteBuffer badDirection = level;
+    badDirection[objects + offsetof(LevelObject, direction)] = 0xff;
+    CHECK(RejectsLevel(map, badDirection));
+
+    // A bad level leaves the map as it was.
+    CHECK(EncodeLevel(map) == initLevel);
+}
+
+TEST_CASE("LevelFormat - Bad corpora")
+{
+    const Game game(MAPS_DIR "baba_is_you.txt");
+    const ByteBuffer corpus =
+        EncodeCorpus({ "baba_is_you.txt" }, { EncodeLevel(game.GetMap()) });
+
+    CHECK(RejectsCorpus(ByteBuffer()));
+    CHECK(RejectsCorpus(
+        ByteBuffer(corpus.begin(), corpus.begin() + sizeof(CorpusHeader))));
+    CHECK(RejectsCorpus(EncodeLevel(game.GetMap())));
+
+    ByteBuffer badVersion = corpus;
+    badVersion[offsetof(CorpusHeader, version)] = 0xff;
+    CHECK(RejectsCorpus(badVersion));
+
+    // The level of the entry must be in the corpus.
+    ByteBuffer badEntry = corpus;
+    const std::uint64_t badSize = corpus.size();
+    std::memcpy(
+        badEntry.data() + sizeof(CorpusHeader) + offsetof(CorpusEntry, size),
+        &badSize, sizeof(badSize));
+    CHECK(RejectsCorpus(badEntry));
+}
@@ -0,0 +1,68 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest.h"
+
+#undef NEAR
+
+#include "TestUtils.hpp"
+
+#include <baba-is-auto/Games/Game.hpp>
+#include <baba-is-auto/Games/LevelTemplate.hpp>
+
+#include <memory>
+#include <random>
+
+using namespace baba_is_auto;
+
+TEST_CASE("LevelTemplate - Shared by games")
+{
+    const auto level =
+        std::make_shared<const LevelTemplate>(MAPS_DIR "baba_is_you.txt");
+    const std::uint64_t initHash = level->GetMap().GetHash();
+
+    Game game1(level), game2(level);
+    Game game3 = game1;
+    CHECK_EQ(game1.GetTemplate().get(), level.get());
+    CHECK_EQ(game2.GetTemplate().get(), level.get());
+    CHECK_EQ(game3.GetTemplate().get(), level.get());
+    CHECK_EQ(game1.Hash(), initHash);
+    CHECK(game1.GetRuleManager().GetAllRules() ==
+          level->GetRuleManager().GetAllRules());
+
+    // Playing and resetting a game changes neither the template nor the
+    // other games.
+    std::mt19937 rng(29);
+    PlayRandomly(game1, rng, 50, [](int) {});
+    PlayRandomly(game2, rng, 30, [](int) {});
+    const std::uint64_t hash2 = game2.Hash();
+
+    CHECK_EQ(level->GetMap().GetHash(), initHash);
+    CHECK_EQ(game3.Hash(), initHash);
+
+    game1.Reset();
+    CHECK_EQ(game1.Hash(), initHash);
+    CHECK_EQ(game2.Hash(), hash2);
+
+    game2.Reset();
+    CHECK_EQ(game2.Hash(), initHash);
+    CHECK_EQ(game1.GetTemplate().get(), level.get());
+}
+
+TEST_CASE("LevelTemplate - Same as a loaded game")
+{
+    for (const char* name : MAPS)
+    {
+        const std::string filename = std::string(MAPS_DIR) + name;
+        const Game game1(filename);
+        const Game game2(std::make_shared<const LevelTemplate>(filename));
+
+        CHECK_EQ(game1.Hash(), game2.Hash());
+        CHECK(game1.GetRuleManager().GetAllRules() ==
+              game2.GetRuleManager().GetAllRules());
+        CHECK(game1.GetPlayState() == game2.GetPlayState());
+    }
+}
@@ -0,0 +1,63 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest.h"
+
+#undef NEAR
+
+#include <baba-is-auto/Agents/MCTSAgent.hpp>
+#include <baba-is-auto/Games/Game.hpp>
+
+#include <numeric>
+#include <stdexcept>
+
+using namespace baba_is_auto;
+
+TEST_CASE("MCTSAgent - Iterations")
+{
+    const Game game(MAPS_DIR "baba_is_you.txt");
+    const std::uint64_t hash = game.Hash();
+
+    for (const MCTSParallelism parallelism :
+         { MCTSParallelism::ROOT, MCTSParallelism::TREE })
+    {
+        for (const std::size_t numThreads : { 1, 4 })
+        {
+            MCTSOptions options;
+            options.maxIterations = 500;
+            options.rolloutDepth = 20;
+            options.numThreads = numThreads;
+            options.parallelism = parallelism;
+
+            // The threads share the iterations, so they run exactly as
+            // many as asked, and each of them visits an action at the root.
+            MCTSAgent agent(options);
+            CHECK(agent.Search(game) != Direction::NONE);
+            CHECK_EQ(agent.GetStats().iterations, 500u);
+            CHECK_EQ(agent.GetStats().numThreads, numThreads);
+            CHECK_EQ(std::accumulate(agent.GetRootVisits().begin(),
+                                     agent.GetRootVisits().end(),
+                                     std::size_t{ 0 }),
+                     500u);
+            CHECK_EQ(game.Hash(), hash);
+        }
+    }
+}
+
+TEST_CASE("MCTSAgent - Limits")
+{
+    MCTSOptions options;
+    options.maxIterations = 0;
+    options.maxSeconds = 0.05;
+
+    MCTSAgent agent(options);
+    CHECK(agent.Search(Game(MAPS_DIR "baba_is_you.txt")) != Direction::NONE);
+    CHECK_GT(agent.GetStats().iterations, 0u);
+
+    // A search needs a bound.
+    options.maxSeconds = 0.0;
+    CHECK_THROWS_AS(MCTSAgent{ options }, std::invalid_argument);
+}
@@ -0,0 +1,165 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest.h"
+
+#undef NEAR
+
+#include "TestUtils.hpp"
+
+#include <baba-is-auto/Games/Game.hpp>
+#include <baba-is-auto/Games/Map.hpp>
+
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace baba_is_auto;
+
+TEST_CASE("Map - Hash")
+{
+    for (const char* name : MAPS)
+    {
+        Game game(std::string(MAPS_DIR) + name);
+        const std::uint64_t initHash = game.Hash();
+        std::mt19937 rng(5);
+
+        CHECK_EQ(initHash, game.GetMap().ComputeHash());
+
+        PlayRandomly(game, rng, 300, [&](int) {
+            // The hash kept by each change must be the hash of the squares.
+            CHECK_EQ(game.Hash(), game.GetMap().ComputeHash());
+
+            if (game.GetPlayState() != PlayState::PLAYING)
+            {
+                Game resetGame = game;
+                resetGame.Reset();
+                CHECK_EQ(resetGame.Hash(), initHash);
+            }
+        });
+    }
+}
+
+TEST_CASE("Map - Hash ignores ids")
+{
+    Map map1(3, 3), map2(3, 3);
+
+    map1.AddObject(1, 1, Object(ObjectType::ICON_ROCK));
+    map1.AddObject(1, 1, Object(ObjectType::ICON_WALL, Direction::LEFT));
+    map2.AddObject(1, 1, Object(ObjectType::ICON_WALL, Direction::LEFT));
+    map2.AddObject(1, 1, Object(ObjectType::ICON_ROCK));
+
+    CHECK_EQ(map1.GetHash(), map2.GetHash());
+    CHECK_EQ(map1.GetHash(), map1.ComputeHash());
+
+    // The direction of an object is a part of the state.
+    map2.AddObject(2, 2, Object(ObjectType::ICON_ROCK, Direction::UP));
+    map1.AddObject(2, 2, Object(ObjectType::ICON_ROCK, Direction::DOWN));
+    CHECK_NE(map1.GetHash(), map2.GetHash());
+}
+
+TEST_CASE("Map - Object ids")
+{
+    for (const char* name : MAPS)
+    {
+        Game game(std::string(MAPS_DIR) + name);
+        const Map& map = game.GetMap();
+        const std::size_t initNumIds = map.GetNumObjectIds();
+        std::size_t maxNumIds = initNumIds;
+        std::mt19937 rng(1);
+
+        PlayRandomly(game, rng, 300, [&](int) {
+            // Each object on a square is found by its id in its place.
+            bool isIndexed = true;
+            std::vector<bool> hasId(map.GetNumObjectIds(), false);
+            std::size_t numObjects = 0;
+            for (std::size_t y = 0; y < map.GetHeight(); ++y)
+            {
+                for (std::size_t x = 0; x < map.GetWidth(); ++x)
+                {
+                    for (const ObjectSlot slot : map.GetSlots(x, y))
+                    {
+                        const ObjectId id = map.GetId(slot);
+                        isIndexed &= id < hasId.size() && !hasId[id] &&
+                                     map.GetSlot(id) == slot &&
+                                     map.FindSlot(id, x, y) == slot &&
+                                     map.GetObject(slot).GetId() == id;
+                        if (id < hasId.size())
+                        {
+                            hasId[id] = true;
+                        }
+                        ++numObjects;
+                    }
+                }
+            }
+
+            CHECK(isIndexed);
+            CHECK_EQ(numObjects, map.GetNumObjects());
+            maxNumIds = std::max(maxNumIds, map.GetNumObjectIds());
+        });
+
+        // The ids of removed objects are given to new objects.
+        CHECK_LE(maxNumIds, 2 * initNumIds);
+    }
+}
+
+TEST_CASE("Map - Object ids of moved and removed objects")
+{
+    Map map(3, 3);
+    map.AddObject(2, 1, Object(ObjectType::ICON_WALL));
+    map.AddObject(1, 1, Object(ObjectType::ICON_ROCK));
+
+    const ObjectSlot slot = *(map.GetSlots(1, 1).end() - 1);
+    const ObjectId id = map.GetId(slot);
+    CHECK_EQ(map.GetType(slot), ObjectType::ICON_ROCK);
+
+    map.MoveObject(slot, 2, 1);
+    CHECK_EQ(map.GetSlot(id), slot);
+    CHECK_EQ(map.FindSlot(id, 2, 1), slot);
+    CHECK_THROWS_AS(map.FindSlot(id, 1, 1), std::invalid_argument);
+
+    // The wall is left on the square, so the id is not given to an empty
+    // object at once.
+    map.RemoveObject(slot);
+    CHECK_EQ(map.GetSlot(id), Map::INVALID_SLOT);
+    CHECK_THROWS_AS(map.FindSlot(id, 2, 1), std::invalid_argument);
+
+    const std::size_t numIds = map.GetNumObjectIds();
+    for (int i = 0; i < 100; ++i)
+    {
+        map.AddObject(0, 0, Object(ObjectType::ICON_ROCK));
+        map.RemoveObject(*(map.GetSlots(0, 0).end() - 1));
+    }
+    CHECK_LE(map.GetNumObjectIds(), numIds + 1);
+    CHECK_EQ(map.GetHash(), map.ComputeHash());
+}
+
+TEST_CASE("Map - Reset")
+{
+    for (const char* name : MAPS)
+    {
+        const Game initGame(std::string(MAPS_DIR) + name);
+        Game game(std::string(MAPS_DIR) + name);
+        std::mt19937 rng(31);
+
+        // A game reset after any play is the game as it was loaded.
+        for (const int numSteps : { 1, 10, 100 })
+        {
+            PlayRandomly(game, rng, numSteps, [](int) {});
+            game.Reset();
+
+            CHECK_EQ(game.Hash(), initGame.Hash());
+            CHECK(game.GetRuleManager().GetAllRules() ==
+                  initGame.GetRuleManager().GetAllRules());
+            CHECK(game.GetPlayState() == initGame.GetPlayState());
+            CHECK_EQ(game.GetMap().GetNumObjects(),
+                     initGame.GetMap().GetNumObjects());
+            CHECK(game.Snapshot() == initGame.Snapshot());
+        }
+    }
+}
@@ -0,0 +1,151 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest.h"
+
+#undef NEAR
+
+#include "TestUtils.hpp"
+
+#include <baba-is-auto/Games/Game.hpp>
+#include <baba-is-auto/Games/MoveResolver.hpp>
+
+#include <random>
+#include <string>
+
+using namespace baba_is_auto;
+
+namespace
+{
+//! Checks the object at (x, y) can move to \p dir by following the chain of
+//! PUSH objects square by square, as the game did before MoveResolver.
+bool CanMoveRecursive(const Map& map, const RuleManager& ruleManager,
+                      std::size_t x, std::size_t y, Direction dir)
+{
+    std::size_t nextX = x, nextY = y;
+    if (dir == Direction::UP && y > 0)
+    {
+        --nextY;
+    }
+    else if (dir == Direction::DOWN && y + 1 < map.GetHeight())
+    {
+        ++nextY;
+    }
+    else if (dir == Direction::LEFT && x > 0)
+    {
+        --nextX;
+    }
+    else if (dir == Direction::RIGHT && x + 1 < map.GetWidth())
+    {
+        ++nextX;
+    }
+    else
+    {
+        return false;
+    }
+
+    for (const ObjectSlot slot : map.GetSlots(nextX, nextY))
+    {
+        // An object that is both PUSH and STOP stops the chain.
+        const ObjectType type = map.GetType(slot);
+        if (ruleManager.HasType(type, ObjectType::PUSH) &&
+            !CanMoveRecursive(map, ruleManager, nextX, nextY, dir))
+        {
+            return false;
+        }
+        else if (ruleManager.HasType(type, ObjectType::STOP))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool IsSameAsRecursive(const Map& map, const RuleManager& ruleManager)
+{
+    MoveResolver resolver;
+
+    for (int dir = 1; dir <= 4; ++dir)
+    {
+        for (std::size_t y = 0; y < map.GetHeight(); ++y)
+        {
+            for (std::size_t x = 0; x < map.GetWidth(); ++x)
+            {
+                if (resolver.CanMove(map, ruleManager, x, y,
+                                     static_cast<Direction>(dir)) !=
+                    CanMoveRecursive(map, ruleManager, x, y,
+                                     static_cast<Direction>(dir)))
+                {
+                    return false;
+                }
+            }
+        }
+    }
+
+    return true;
+}
+}  // namespace
+
+TEST_CASE("MoveResolver - Random maps")
+{
+    RuleManager ruleManager;
+    ruleManager.AddRule(
+        Rule(ObjectType::ROCK, ObjectType::IS, ObjectType::PUSH));
+    ruleManager.AddRule(
+        Rule(ObjectType::WALL, ObjectType::IS, ObjectType::STOP));
+    ruleManager.AddRule(
+        Rule(ObjectType::KEKE, ObjectType::IS, ObjectType::PUSH));
+    ruleManager.AddRule(
+        Rule(ObjectType::KEKE, ObjectType::IS, ObjectType::STOP));
+
+    std::mt19937 rng(7);
+
+    // Maps wider than 64 squares have rows across the words of a bitboard.
+    for (int trial = 0; trial < 300; ++trial)
+    {
+        const std::size_t width = 1 + rng() % 70, height = 1 + rng() % 70;
+        const unsigned int density = rng() % 100;
+        Map map(width, height);
+
+        for (std::size_t y = 0; y < height; ++y)
+        {
+            for (std::size_t x = 0; x < width; ++x)
+            {
+                if (rng() % 100 < density)
+                {
+                    map.AddObject(x, y, Object(ObjectType::ICON_ROCK));
+                }
+                if (rng() % 20 == 0)
+                {
+                    map.AddObject(x, y, Object(ObjectType::ICON_WALL));
+                }
+                if (rng() % 40 == 0)
+                {
+                    map.AddObject(x, y, Object(ObjectType::ICON_KEKE));
+                }
+            }
+        }
+
+        CHECK(IsSameAsRecursive(map, ruleManager));
+    }
+}
+
+TEST_CASE("MoveResolver - Maps")
+{
+    for (const char* name : MAPS)
+    {
+        Game game(std::string(MAPS_DIR) + name);
+        std::mt19937 rng(7);
+
+        PlayRandomly(game, rng, 500, [&](int step) {
+            if (step % 5 == 0)
+            {
+                CHECK(IsSameAsRecursive(game.GetMap(), game.GetRuleManager()));
+            }
+        });
+    }
+}
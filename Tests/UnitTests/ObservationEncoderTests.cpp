@@ -0,0 +1,133 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest.h"
+
+#undef NEAR
+
+#include "TestUtils.hpp"
+
+#include <baba-is-auto/Agents/ObservationEncoder.hpp>
+#include <baba-is-auto/Agents/Preprocess.hpp>
+
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace baba_is_auto;
+
+namespace
+{
+//! Encodes \p game as Preprocess did before ObservationEncoder, leaving out
+//! the objects of the types it did not map.
+std::vector<float> EncodeOldLayout(const Game& game)
+{
+    const std::map<ObjectType, std::size_t> channels = {
+        { ObjectType::BABA, 0 },      { ObjectType::IS, 1 },
+        { ObjectType::YOU, 2 },       { ObjectType::ICON_EMPTY, 3 },
+        { ObjectType::FLAG, 4 },      { ObjectType::WIN, 5 },
+        { ObjectType::ICON_WALL, 6 }, { ObjectType::ICON_ROCK, 7 },
+        { ObjectType::ICON_BABA, 8 }, { ObjectType::ICON_FLAG, 9 },
+        { ObjectType::WALL, 10 },     { ObjectType::STOP, 11 },
+        { ObjectType::ROCK, 12 },     { ObjectType::PUSH, 13 }
+    };
+
+    const Map& map = game.GetMap();
+    const std::size_t width = map.GetWidth(), height = map.GetHeight();
+    std::vector<float> tensor(16 * width * height, 0.0f);
+
+    const auto ToIndex = [width, height](std::size_t x, std::size_t y,
+                                         std::size_t c) {
+        return (c * width * height) + (y * width) + x;
+    };
+
+    for (std::size_t y = 0; y < height; ++y)
+    {
+        for (std::size_t x = 0; x < width; ++x)
+        {
+            bool isTextType = false;
+            for (const ObjectSlot slot : map.GetSlots(x, y))
+            {
+                const ObjectType type = map.GetType(slot);
+                const auto iter = channels.find(type);
+                if (iter != channels.end())
+                {
+                    tensor[ToIndex(x, y, iter->second)] = 1.0f;
+                }
+
+                isTextType |= IsTextType(type);
+            }
+
+            tensor[ToIndex(x, y, 14)] = isTextType ? 1.0f : 0.0f;
+            tensor[ToIndex(x, y, 15)] = map.IsRule(x, y) ? 1.0f : 0.0f;
+        }
+    }
+
+    return tensor;
+}
+}  // namespace
+
+TEST_CASE("ObservationEncoder - Default spec")
+{
+    const ObservationEncoder& encoder = ObservationEncoder::GetDefault();
+    CHECK_EQ(encoder.GetNumChannels(),
+             static_cast<std::size_t>(Preprocess::TENSOR_DIM));
+    CHECK_EQ(encoder.GetChannel(ObjectType::BABA), 0);
+    CHECK_EQ(encoder.GetChannel(ObjectType::PUSH), 13);
+    CHECK_EQ(encoder.GetChannel(ObjectType::ICON_KEKE), -1);
+
+    for (const char* name : MAPS)
+    {
+        Game game(std::string(MAPS_DIR) + name);
+        std::mt19937 rng(17);
+
+        CHECK(Preprocess::StateToTensor(game) == EncodeOldLayout(game));
+
+        PlayRandomly(game, rng, 100, [&](int) {
+            CHECK(Preprocess::StateToTensor(game) == EncodeOldLayout(game));
+            CHECK(encoder.Encode(game) == Preprocess::StateToTensor(game));
+        });
+    }
+}
+
+TEST_CASE("ObservationEncoder - EncodeChanges")
+{
+    const ObservationEncoder encoders[] = {
+        ObservationEncoder(ObservationEncoder::MakeDefaultSpec()),
+        ObservationEncoder(ObservationEncoder::MakeFullSpec(false)),
+        ObservationEncoder(ObservationEncoder::MakeFullSpec(true))
+    };
+
+    for (const ObservationEncoder& encoder : encoders)
+    {
+        for (const char* name : MAPS)
+        {
+            Game game(std::string(MAPS_DIR) + name);
+            std::mt19937 rng(19);
+
+            // A game that is over is reset before the next step, so its
+            // tensor goes back to the one of the initial state.
+            const std::vector<float> initTensor = encoder.Encode(game);
+            std::vector<float> tensor = initTensor;
+            bool isReset = false;
+
+            PlayRandomly(game, rng, 200, [&](int) {
+                if (isReset)
+                {
+                    tensor = initTensor;
+                }
+
+                // Patching the squares changed by a step must give the
+                // tensor encoded from scratch.
+                encoder.EncodeChanges(game, tensor.data());
+                CHECK(tensor == encoder.Encode(game));
+
+                isReset = game.GetPlayState() != PlayState::PLAYING;
+            });
+        }
+    }
+}
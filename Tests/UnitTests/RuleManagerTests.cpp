@@ -0,0 +1,72 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest.h"
+
+#undef NEAR
+
+#include "TestUtils.hpp"
+
+#include <baba-is-auto/Games/Game.hpp>
+#include <baba-is-auto/Rules/RuleManager.hpp>
+
+#include <random>
+#include <string>
+
+using namespace baba_is_auto;
+
+namespace
+{
+bool HasSameRuleFlags(const Map& map1, const Map& map2)
+{
+    for (std::size_t y = 0; y < map1.GetHeight(); ++y)
+    {
+        for (std::size_t x = 0; x < map1.GetWidth(); ++x)
+        {
+            if (map1.IsRule(x, y) != map2.IsRule(x, y))
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+}  // namespace
+
+TEST_CASE("RuleManager - UpdateRules")
+{
+    for (const char* name : MAPS)
+    {
+        Game game(std::string(MAPS_DIR) + name);
+        std::mt19937 rng(11);
+
+        PlayRandomly(game, rng, 200, [&](int) {
+            // The rules updated from the dirty lines must be the rules
+            // parsed from scratch.
+            Map map = game.GetMap();
+            RuleManager ruleManager;
+            ruleManager.ParseRules(map);
+
+            CHECK(game.GetRuleManager().GetAllRules() ==
+                  ruleManager.GetAllRules());
+            CHECK(game.GetRuleManager().GetPropertyTable() ==
+                  ruleManager.GetPropertyTable());
+            CHECK(HasSameRuleFlags(game.GetMap(), map));
+        });
+    }
+}
+
+TEST_CASE("RuleManager - UpdateRules without dirty lines")
+{
+    Game game(MAPS_DIR "baba_is_you.txt");
+    const std::vector<Rule> rules = game.GetRuleManager().GetAllRules();
+
+    // BABA only moves on squares without texts, so no line is parsed again.
+    game.MovePlayer(Direction::DOWN);
+    CHECK_FALSE(game.GetRuleManager().HasChangedProperties());
+    CHECK(game.GetRuleManager().GetAllRules() == rules);
+}
@@ -0,0 +1,188 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest.h"
+
+#undef NEAR
+
+#include "TestUtils.hpp"
+
+#include <baba-is-auto/Games/Game.hpp>
+
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace baba_is_auto;
+
+namespace
+{
+std::vector<std::uint64_t> PlayMoves(Game& game,
+                                     const std::vector<Direction>& moves)
+{
+    std::vector<std::uint64_t> hashes;
+    for (const Direction dir : moves)
+    {
+        if (game.GetPlayState() != PlayState::PLAYING)
+        {
+            break;
+        }
+
+        game.MovePlayer(dir);
+        hashes.emplace_back(game.Hash());
+    }
+
+    return hashes;
+}
+
+bool RejectsSnapshot(Game& game, const GameSnapshot& snapshot)
+{
+    try
+    {
+        game.Restore(snapshot);
+    }
+    catch (const std::invalid_argument&)
+    {
+        return true;
+    }
+
+    return false;
+}
+}  // namespace
+
+TEST_CASE("Game - Snapshot and Restore")
+{
+    for (const char* name : MAPS)
+    {
+        Game game(std::string(MAPS_DIR) + name);
+        std::mt19937 rng(3);
+
+        for (int trial = 0; trial < 10; ++trial)
+        {
+            game.Reset();
+            std::vector<Direction> moves;
+            for (int i = 0; i < 40; ++i)
+            {
+                moves.emplace_back(RandomDirection(rng));
+            }
+            PlayMoves(game, moves);
+
+            const GameSnapshot snapshot = game.Snapshot();
+            const std::vector<Direction> nextMoves(moves.rbegin(),
+                                                   moves.rend());
+            const std::vector<std::uint64_t> hashes =
+                PlayMoves(game, nextMoves);
+
+            // The game goes on from the snapshot as it did the first time,
+            // whether the snapshot is checked or not.
+            PlayMoves(game, moves);
+            if (trial % 2 == 0)
+            {
+                game.Restore(snapshot);
+            }
+            else
+            {
+                game.RestoreTrusted(snapshot);
+            }
+            CHECK(game.Snapshot() == snapshot);
+            CHECK(PlayMoves(game, nextMoves) == hashes);
+        }
+    }
+}
+
+TEST_CASE("Game - Snapshot into another game")
+{
+    Game game1(MAPS_DIR "baba_is_you.txt"), game2(MAPS_DIR "baba_is_you.txt");
+
+    game1.MovePlayer(Direction::RIGHT);
+    game1.MovePlayer(Direction::UP);
+
+    GameSnapshot snapshot;
+    game1.Snapshot(snapshot);
+    game2.Restore(snapshot);
+
+    CHECK_EQ(game2.Hash(), game1.Hash());
+    CHECK(game2.Snapshot() == snapshot);
+    CHECK(game2.GetRuleManager().GetAllRules() ==
+          game1.GetRuleManager().GetAllRules());
+}
+
+TEST_CASE("Game - Snapshot of a map changed between steps")
+{
+    Game game1(MAPS_DIR "baba_is_you.txt"), game2(MAPS_DIR "baba_is_you.txt");
+
+    // The text is only parsed by the next step, so its line is still dirty.
+    game1.GetMap().AddObject(1, 1, Object(ObjectType::ROCK));
+    CHECK(game1.GetMap().HasDirtyLines());
+
+    game2.Restore(game1.Snapshot());
+    CHECK(game2.GetMap().HasDirtyLines());
+
+    game1.MovePlayer(Direction::DOWN);
+    game2.MovePlayer(Direction::DOWN);
+    CHECK_EQ(game2.Hash(), game1.Hash());
+    CHECK(game2.GetRuleManager().GetAllRules() ==
+          game1.GetRuleManager().GetAllRules());
+    CHECK(game2.Snapshot() == game1.Snapshot());
+}
+
+TEST_CASE("Game - Restore bad snapshots")
+{
+    Game game(MAPS_DIR "volcano.txt");
+    game.MovePlayer(Direction::LEFT);
+    const GameSnapshot snapshot = game.Snapshot();
+
+    game.Reset();
+    const GameSnapshot initSnapshot = game.Snapshot();
+
+    CHECK(RejectsSnapshot(game, GameSnapshot()));
+
+    bool rejectsTruncated = true;
+    for (std::size_t size = 0; size < snapshot.size(); ++size)
+    {
+        rejectsTruncated &= RejectsSnapshot(
+            game, GameSnapshot(snapshot.begin(), snapshot.begin() + size));
+    }
+    CHECK(rejectsTruncated);
+
+    GameSnapshot longSnapshot = snapshot;
+    longSnapshot.emplace_back(0);
+    CHECK(RejectsSnapshot(game, longSnapshot));
+
+    GameSnapshot badPlayState = snapshot;
+    badPlayState[0] = 0xff;
+    CHECK(RejectsSnapshot(game, badPlayState));
+
+    const Game otherGame(MAPS_DIR "baba_is_you.txt");
+    CHECK(RejectsSnapshot(game, otherGame.Snapshot()));
+
+    // A bad snapshot leaves the game as it was.
+    CHECK(game.Snapshot() == initSnapshot);
+
+    game.Restore(snapshot);
+    CHECK(game.Snapshot() == snapshot);
+}
+
+TEST_CASE("Game - Snapshot size")
+{
+    for (const char* name : MAPS)
+    {
+        Game game(std::string(MAPS_DIR) + name);
+        const std::size_t initSize = game.Snapshot().size();
+        std::size_t maxSize = initSize;
+        std::mt19937 rng(7);
+
+        // Removed objects give their room back, so the snapshot does not
+        // grow with the number of steps.
+        PlayRandomly(game, rng, 2000, [&](int) {
+            maxSize = std::max(maxSize, game.Snapshot().size());
+        });
+
+        CHECK_LE(maxSize, 2 * initSize);
+    }
+}
@@ -0,0 +1,171 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest.h"
+
+#undef NEAR
+
+#include "TestUtils.hpp"
+
+#include <baba-is-auto/Agents/BFSSolverAgent.hpp>
+#include <baba-is-auto/Agents/HeuristicSearchAgent.hpp>
+#include <baba-is-auto/Agents/ParallelBFSSolverAgent.hpp>
+#include <baba-is-auto/Games/Game.hpp>
+
+#include <string>
+#include <vector>
+
+using namespace baba_is_auto;
+
+namespace
+{
+//! The maps that BFS solves in a moment.
+const char* const SOLVABLE_MAPS[] = { "baba_is_you.txt", "debug.txt",
+                                      "debug2.txt", "debug3.txt" };
+
+//! Checks \p solution wins \p game, which is not modified.
+bool IsWinningSolution(const Game& game,
+                       const std::vector<Direction>& solution)
+{
+    Game work = game;
+    for (const Direction dir : solution)
+    {
+        if (work.GetPlayState() != PlayState::PLAYING)
+        {
+            return false;
+        }
+        work.MovePlayer(dir);
+    }
+
+    return work.GetPlayState() == PlayState::WON;
+}
+}  // namespace
+
+TEST_CASE("BFSSolverAgent - Solve")
+{
+    const Game game(MAPS_DIR "baba_is_you.txt");
+    const std::uint64_t hash = game.Hash();
+
+    BFSSolverAgent agent;
+    CHECK(agent.Solve(game) == SearchStatus::SOLVED);
+    CHECK_EQ(agent.GetSolution().size(), 8u);
+    CHECK(IsWinningSolution(game, agent.GetSolution()));
+    CHECK_EQ(game.Hash(), hash);
+
+    // GetAction follows the solution it has found.
+    Game play = game;
+    for (std::size_t i = 0; i < agent.GetSolution().size(); ++i)
+    {
+        play.MovePlayer(agent.GetAction(play));
+    }
+    CHECK(play.GetPlayState() == PlayState::WON);
+}
+
+TEST_CASE("BFSSolverAgent - Unsolvable and limits")
+{
+    BFSSolverAgent agent;
+    CHECK(agent.Solve(Game(MAPS_DIR "simple_map.txt")) ==
+          SearchStatus::UNSOLVABLE);
+    CHECK(agent.GetSolution().empty());
+
+    // A search that reaches its bounds gives up without a solution.
+    agent.SetLimits(SearchLimits{ 100, 0.0 });
+    CHECK(agent.Solve(Game(MAPS_DIR "volcano.txt")) ==
+          SearchStatus::LIMIT_REACHED);
+    CHECK_EQ(agent.GetStats().nodesExpanded, 100u);
+    CHECK(agent.GetSolution().empty());
+
+    agent.SetLimits(SearchLimits{ 0, 0.05 });
+    CHECK(agent.Solve(Game(MAPS_DIR "volcano.txt")) ==
+          SearchStatus::LIMIT_REACHED);
+}
+
+TEST_CASE("HeuristicSearchAgent - Same length as BFS")
+{
+    for (const char* name : SOLVABLE_MAPS)
+    {
+        const Game game(std::string(MAPS_DIR) + name);
+
+        BFSSolverAgent bfs;
+        REQUIRE(bfs.Solve(game) == SearchStatus::SOLVED);
+
+        // The default heuristic is admissible, so both searches find a
+        // shortest solution.
+        for (const SearchAlgorithm algorithm :
+             { SearchAlgorithm::A_STAR, SearchAlgorithm::IDA_STAR })
+        {
+            HeuristicSearchAgent agent(algorithm);
+            CHECK(agent.Solve(game) == SearchStatus::SOLVED);
+            CHECK_EQ(agent.GetSolution().size(), bfs.GetSolution().size());
+            CHECK(IsWinningSolution(game, agent.GetSolution()));
+        }
+
+        // The guided heuristic finds a solution, not always a shortest one.
+        HeuristicSearchAgent agent(SearchAlgorithm::A_STAR,
+                                   MakeGuidedHeuristic());
+        CHECK(agent.Solve(game) == SearchStatus::SOLVED);
+        CHECK_GE(agent.GetSolution().size(), bfs.GetSolution().size());
+        CHECK(IsWinningSolution(game, agent.GetSolution()));
+    }
+}
+
+TEST_CASE("HeuristicSearchAgent - Limits")
+{
+    const Game game(MAPS_DIR "volcano.txt");
+
+    for (const SearchAlgorithm algorithm :
+         { SearchAlgorithm::A_STAR, SearchAlgorithm::IDA_STAR })
+    {
+        HeuristicSearchAgent agent(algorithm, nullptr,
+                                   SearchLimits{ 100, 0.0 });
+        CHECK(agent.Solve(game) == SearchStatus::LIMIT_REACHED);
+        CHECK_EQ(agent.GetStats().nodesExpanded, 100u);
+        CHECK(agent.GetSolution().empty());
+
+        agent.SetLimits(SearchLimits{ 0, 0.05 });
+        CHECK(agent.Solve(game) == SearchStatus::LIMIT_REACHED);
+    }
+}
+
+TEST_CASE("ParallelBFSSolverAgent - Same length as BFS")
+{
+    for (const char* name : SOLVABLE_MAPS)
+    {
+        const Game game(std::string(MAPS_DIR) + name);
+
+        BFSSolverAgent bfs;
+        REQUIRE(bfs.Solve(game) == SearchStatus::SOLVED);
+
+        // The solution may differ from the one of BFS, but not its length.
+        for (const std::size_t numThreads : { 1, 4 })
+        {
+            ParallelBFSSolverAgent agent(numThreads);
+            CHECK(agent.Solve(game) == SearchStatus::SOLVED);
+            CHECK_EQ(agent.GetSolution().size(), bfs.GetSolution().size());
+            CHECK(IsWinningSolution(game, agent.GetSolution()));
+        }
+    }
+}
+
+TEST_CASE("ParallelBFSSolverAgent - Unsolvable and limits")
+{
+    for (const std::size_t numThreads : { 1, 4 })
+    {
+        ParallelBFSSolverAgent agent(numThreads);
+        CHECK(agent.Solve(Game(MAPS_DIR "simple_map.txt")) ==
+              SearchStatus::UNSOLVABLE);
+
+        agent.SetLimits(SearchLimits{ 100, 0.0 });
+        CHECK(agent.Solve(Game(MAPS_DIR "volcano.txt")) ==
+              SearchStatus::LIMIT_REACHED);
+        CHECK_EQ(agent.GetStats().nodesExpanded, 100u);
+        CHECK(agent.GetSolution().empty());
+
+        agent.SetLimits(SearchLimits{ 0, 0.05 });
+        CHECK(agent.Solve(Game(MAPS_DIR "volcano.txt")) ==
+              SearchStatus::LIMIT_REACHED);
+    }
+}
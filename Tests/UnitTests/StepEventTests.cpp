@@ -0,0 +1,186 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest.h"
+
+#undef NEAR
+
+#include "TestUtils.hpp"
+
+#include <baba-is-auto/Games/Game.hpp>
+#include <baba-is-auto/Games/StepEvent.hpp>
+
+#include <algorithm>
+#include <map>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+using namespace baba_is_auto;
+
+namespace
+{
+using ObjectState = std::tuple<ObjectType, std::size_t, std::size_t>;
+using RuleState = std::tuple<ObjectType, ObjectType, ObjectType>;
+
+std::map<ObjectId, ObjectState> GetObjects(const Map& map)
+{
+    std::map<ObjectId, ObjectState> objects;
+    for (std::size_t y = 0; y < map.GetHeight(); ++y)
+    {
+        for (std::size_t x = 0; x < map.GetWidth(); ++x)
+        {
+            // The empty icons only fill the squares without objects.
+            for (const ObjectSlot slot : map.GetSlots(x, y))
+            {
+                if (map.GetType(slot) != ObjectType::ICON_EMPTY)
+                {
+                    objects[map.GetId(slot)] = { map.GetType(slot), x, y };
+                }
+            }
+        }
+    }
+
+    return objects;
+}
+
+std::vector<RuleState> GetRules(const RuleManager& ruleManager)
+{
+    std::vector<RuleState> rules;
+    for (const Rule& rule : ruleManager.GetAllRules())
+    {
+        rules.emplace_back(rule.GetSubject(), rule.GetOperator(),
+                           rule.GetPredicate());
+    }
+    std::sort(rules.begin(), rules.end());
+
+    return rules;
+}
+
+//! Applies \p events to the objects, rules and play state of before a step.
+//! \return The flag indicates that each event applies to the state it is
+//! applied to, in the order of the events.
+bool ApplyEvents(const std::vector<StepEvent>& events,
+                 std::map<ObjectId, ObjectState>& objects,
+                 std::vector<RuleState>& rules, PlayState& playState)
+{
+    // The changes of rules and of the play state come last.
+    bool hasObjectEvents = true;
+
+    for (const StepEvent& event : events)
+    {
+        const auto iter = objects.find(event.id);
+        const bool isAt =
+            iter != objects.end() &&
+            iter->second == ObjectState{ event.objectType, event.x, event.y };
+
+        switch (event.type)
+        {
+            case StepEventType::MOVED:
+                if (!hasObjectEvents || !isAt)
+                {
+                    return false;
+                }
+                iter->second = { event.objectType, event.toX, event.toY };
+                break;
+            case StepEventType::REMOVED:
+                if (!hasObjectEvents || !isAt)
+                {
+                    return false;
+                }
+                objects.erase(iter);
+                break;
+            case StepEventType::TYPE_CHANGED:
+                if (!hasObjectEvents || !isAt)
+                {
+                    return false;
+                }
+                iter->second = { event.newType, event.x, event.y };
+                break;
+            case StepEventType::RULE_ADDED:
+            case StepEventType::RULE_REMOVED:
+            {
+                hasObjectEvents = false;
+
+                const RuleState rule{ event.subject, event.op,
+                                      event.predicate };
+                if (event.type == StepEventType::RULE_ADDED)
+                {
+                    rules.insert(
+                        std::upper_bound(rules.begin(), rules.end(), rule),
+                        rule);
+                    break;
+                }
+
+                const auto ruleIter =
+                    std::find(rules.begin(), rules.end(), rule);
+                if (ruleIter == rules.end())
+                {
+                    return false;
+                }
+                rules.erase(ruleIter);
+                break;
+            }
+            case StepEventType::PLAY_STATE_CHANGED:
+                if (&event != &events.back() ||
+                    event.playState == playState)
+                {
+                    return false;
+                }
+                hasObjectEvents = false;
+                playState = event.playState;
+                break;
+        }
+    }
+
+    return true;
+}
+}  // namespace
+
+TEST_CASE("Game - Step events")
+{
+    for (const char* name : MAPS)
+    {
+        Game game(std::string(MAPS_DIR) + name);
+        game.SetRecordEvents(true);
+        std::mt19937 rng(23);
+
+        std::map<ObjectId, ObjectState> objects = GetObjects(game.GetMap());
+        std::vector<RuleState> rules = GetRules(game.GetRuleManager());
+        PlayState playState = game.GetPlayState();
+
+        // The events of a step applied to the state of before the step must
+        // give the state of after it.
+        PlayRandomly(game, rng, 300, [&](int) {
+            CHECK(ApplyEvents(game.GetEvents(), objects, rules, playState));
+            CHECK(objects == GetObjects(game.GetMap()));
+            CHECK(rules == GetRules(game.GetRuleManager()));
+            CHECK(playState == game.GetPlayState());
+
+            if (game.GetPlayState() != PlayState::PLAYING)
+            {
+                Game resetGame = game;
+                resetGame.Reset();
+                objects = GetObjects(resetGame.GetMap());
+                rules = GetRules(resetGame.GetRuleManager());
+                playState = resetGame.GetPlayState();
+            }
+        });
+    }
+}
+
+TEST_CASE("Game - Step events are off by default")
+{
+    Game game1(MAPS_DIR "baba_is_you.txt"), game2(MAPS_DIR "baba_is_you.txt");
+    CHECK_FALSE(game1.IsRecordingEvents());
+
+    game2.SetRecordEvents(true);
+    game1.MovePlayer(Direction::RIGHT);
+    game2.MovePlayer(Direction::RIGHT);
+    CHECK(game1.GetEvents().empty());
+    CHECK_FALSE(game2.GetEvents().empty());
+}
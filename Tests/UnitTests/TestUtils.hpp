@@ -0,0 +1,53 @@
+// Copyright (c) 2020 Chris Ohk
+
+// I am making my contributions/submissions to this project solely in our
+// personal capacity and am not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef BABA_IS_AUTO_TEST_UTILS_HPP
+#define BABA_IS_AUTO_TEST_UTILS_HPP
+
+#include <baba-is-auto/Games/Game.hpp>
+
+#include <random>
+
+namespace baba_is_auto
+{
+//! The maps in MAPS_DIR that the tests play.
+inline const char* const MAPS[] = { "baba_is_you.txt", "out_of_reach.txt",
+                                    "volcano.txt",     "simple_map.txt",
+                                    "debug.txt",       "debug2.txt",
+                                    "debug3.txt",      "debug4.txt" };
+
+//! Picks one of the four moves of the player.
+//! \param rng The random engine.
+//! \return The direction to move the player.
+inline Direction RandomDirection(std::mt19937& rng)
+{
+    return static_cast<Direction>(1 + rng() % 4);
+}
+
+//! Plays \p numSteps random moves on \p game. \p onStep is called with the
+//! index of the step after each move, and the game is reset when it is over.
+//! \param game The game to play.
+//! \param rng The random engine.
+//! \param numSteps The number of moves.
+//! \param onStep The function to call after each move.
+template <typename Callback>
+void PlayRandomly(Game& game, std::mt19937& rng, int numSteps,
+                  Callback&& onStep)
+{
+    for (int step = 0; step < numSteps; ++step)
+    {
+        game.MovePlayer(RandomDirection(rng));
+        onStep(step);
+
+        if (game.GetPlayState() != PlayState::PLAYING)
+        {
+            game.Reset();
+        }
+    }
+}
+}  // namespace baba_is_auto
+
+#endif  // BABA_IS_AUTO_TEST_UTILS_HPP